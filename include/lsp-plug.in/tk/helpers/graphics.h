@@ -94,6 +94,20 @@ namespace lsp
             float x, float y,                               // Coordinates of point
             float lc, float rc, float tc, float bc          // Corners: left, right, top, bottom
         );
+
+        /**
+         * Reduce the number of points of the polyline to the resolution of pixel columns.
+         * Each run of consecutive points within the same pixel column is replaced by the
+         * first point, the points with minimum and maximum vertical coordinate and the last
+         * point, so peaks are preserved. The operation is performed in-place.
+         * Polylines with non-monotonic horizontal coordinates are left untouched.
+         *
+         * @param x horizontal coordinates of points
+         * @param y vertical coordinates of points
+         * @param n number of points
+         * @return number of points after decimation
+         */
+        size_t decimate2d(float *x, float *y, size_t n);
     }
 }
 
@@ -38,8 +38,33 @@ namespace lsp
             private:
                 FloatArray & operator = (const FloatArray &);
 
+            protected:
+                enum peaks_t
+                {
+                    PEAK_SHIFT      = 4,                    // Log2 of number of elements per block
+                    PEAK_BLOCK      = 1 << PEAK_SHIFT,      // Number of elements per block
+                    PEAK_LEVELS     = 8                     // Maximum number of levels of the peak pyramid
+                };
+
+                typedef struct peak_t
+                {
+                    float                   fMin;           // Minimum value of the block
+                    float                   fMax;           // Maximum value of the block
+                } peak_t;
+
             protected:
                 lltl::darray<float>     vItems;
+                lltl::darray<peak_t>    vPeaks[PEAK_LEVELS];    // Peak pyramid, each level decimates the previous one
+                size_t                  nDirtyFirst;            // First dirty element of the pyramid
+                size_t                  nDirtyLast;             // Last dirty element of the pyramid (exclusive)
+                bool                    bPeaks;                 // Peak pyramid has been requested
+                bool                    bDirty;                 // Peak pyramid needs to be updated
+
+            protected:
+                void                invalidate(size_t first, size_t last);
+                void                drop_peaks();
+                bool                update_peaks();
+                void                scan_range(float *min, float *max, ssize_t level, size_t first, size_t last) const;
 
             protected:
                 explicit FloatArray(prop::Listener *listener = NULL);
@@ -71,6 +96,19 @@ namespace lsp
                  */
                 float               get(size_t index) const;
 
+                /**
+                 * Get minimum and maximum values of the range of elements. The call
+                 * builds the min/max peak pyramid on first use and then updates it
+                 * incrementally, so the lookup costs O(log(count)) instead of O(count)
+                 *
+                 * @param min pointer to store the minimum value
+                 * @param max pointer to store the maximum value
+                 * @param first index of the first element in the range
+                 * @param count number of elements in the range
+                 * @return false if the range is empty or there is not enough memory
+                 */
+                bool                peaks(float *min, float *max, size_t first, size_t count);
+
             public:
                 /**
                  * Clear the collection, trims the array to 0 elements
@@ -68,6 +68,17 @@ namespace lsp
                 status_t        set(Widget *w, size_t index, bool manage);
                 status_t        swap(GenericWidgetList *dst);
                 status_t        xswap(size_t i1, size_t i2);
+
+                /**
+                 * Replace the contents of the list with the specified widgets. Widgets that
+                 * are present in both lists keep their management flag and the collection
+                 * listener is not triggered for them, the listener is notified only once.
+                 *
+                 * @param list list of widgets
+                 * @param manage management flag for widgets not present in the list
+                 * @return status of operation
+                 */
+                status_t        assign(const lltl::parray<Widget> *list, bool manage);
         };
 
         template <class widget_t>
@@ -94,6 +105,9 @@ namespace lsp
 
                     inline status_t     swap(WidgetList<widget_t> *lst)     { return GenericWidgetList::swap(lst);                  }
                     inline status_t     swap(WidgetList<widget_t> &lst)     { return GenericWidgetList::swap(&lst);                 }
+
+                    inline status_t     assign(const lltl::parray<Widget> *list)    { return GenericWidgetList::assign(list, false);    }
+                    inline status_t     massign(const lltl::parray<Widget> *list)   { return GenericWidgetList::assign(list, true);     }
             };
 
         namespace prop
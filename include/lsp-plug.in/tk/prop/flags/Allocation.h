@@ -40,6 +40,8 @@ namespace lsp
         class Allocation: public Flags
         {
             private:
+                friend class Atoms;
+
                 Allocation & operator = (const Allocation &);
 
             protected:
@@ -37,6 +37,9 @@ namespace lsp
          */
         class Color: public MultiProperty
         {
+            private:
+                friend class Atoms;
+
             protected:
                 Color & operator = (const Color &);
 
@@ -35,6 +35,9 @@ namespace lsp
          */
         class Font: public MultiProperty
         {
+            private:
+                friend class Atoms;
+
             protected:
                 Font & operator = (const Font &);
 
@@ -78,6 +81,8 @@ namespace lsp
 
             protected:
                 void                push_masked(size_t mask);
+                TextCache          *text_cache() const;
+                bool                measure(ws::ISurface *s, const ws::Font *f, ws::text_parameters_t *tp, const LSPString *text, ssize_t first, ssize_t last) const;
                 virtual void        push();
                 virtual void        commit(atom_t property);
 
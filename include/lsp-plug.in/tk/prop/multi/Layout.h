@@ -41,6 +41,9 @@ namespace lsp
          */
         class Layout: public MultiProperty
         {
+            private:
+                friend class Atoms;
+
             protected:
                 Layout & operator = (const Layout &);
 
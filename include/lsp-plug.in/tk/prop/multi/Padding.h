@@ -32,6 +32,9 @@ namespace lsp
     {
         class Padding: public MultiProperty
         {
+            private:
+                friend class Atoms;
+
             protected:
                 Padding & operator = (const Padding &);
 
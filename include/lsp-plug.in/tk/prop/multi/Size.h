@@ -84,6 +84,9 @@ namespace lsp
 
                 static bool         overlap(const ws::rectangle_t *a, const ws::rectangle_t *b);
                 static bool         is_empty(const ws::rectangle_t *r);
+                static bool         contains(const ws::rectangle_t *outer, const ws::rectangle_t *inner);
+                static void         enclose(ws::rectangle_t *dst, const ws::rectangle_t *a, const ws::rectangle_t *b);
+                static inline void  enclose(ws::rectangle_t *dst, const ws::rectangle_t *src) { enclose(dst, dst, src); }
         };
 
         namespace prop
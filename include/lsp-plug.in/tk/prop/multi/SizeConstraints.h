@@ -32,6 +32,9 @@ namespace lsp
     {
         class SizeConstraints: public MultiProperty
         {
+            private:
+                friend class Atoms;
+
             protected:
                 SizeConstraints & operator = (const SizeConstraints &);
 
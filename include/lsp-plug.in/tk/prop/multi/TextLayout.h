@@ -38,6 +38,9 @@ namespace lsp
          */
         class TextLayout: public MultiProperty
         {
+            private:
+                friend class Atoms;
+
             protected:
                 TextLayout & operator = (const TextLayout &);
 
@@ -57,17 +57,34 @@ namespace lsp
                         virtual void    notify(atom_t property);
                 };
 
+                enum coord_t
+                {
+                    C_X,
+                    C_Y,
+
+                    C_COUNT
+                };
+
+                typedef struct range_t
+                {
+                    size_t          nFirst;             // First changed element
+                    size_t          nLast;              // Last changed element + 1
+                } range_t;
+
             protected:
                 float          *vData;
                 size_t          nSize;
                 size_t          nStride;
                 uint8_t        *pPtr;
+                range_t         vChanges[C_COUNT];  // Changed ranges of each coordinate
 
                 atom_t          vAtoms[P_COUNT];    // Atoms
                 Listener        sListener;          // Listener
 
             protected:
-                void            copy_data(float *dst, const float *src, size_t n);
+                void            copy_data(size_t coord, const float *src, size_t n);
+                void            mark_changed(size_t coord, size_t first, size_t last);
+                bool            get_changes(size_t coord, size_t *first, size_t *count) const;
                 void            sync();
                 void            commit(atom_t property);
                 bool            resize_buffer(size_t size);
@@ -89,6 +106,29 @@ namespace lsp
                 bool                set_y(const float *v, size_t size);
                 inline bool         set_y(const float *v)       { return set_y(v, nSize);       }
                 bool                set(const float *x, const float *y, size_t size);
+
+                /**
+                 * Get the range of X coordinates changed since the last call of advance()
+                 *
+                 * @param first pointer to store the index of the first changed element
+                 * @param count pointer to store the number of changed elements
+                 * @return true if there are changes
+                 */
+                inline bool         x_changes(size_t *first, size_t *count) const   { return get_changes(C_X, first, count); }
+
+                /**
+                 * Get the range of Y coordinates changed since the last call of advance()
+                 *
+                 * @param first pointer to store the index of the first changed element
+                 * @param count pointer to store the number of changed elements
+                 * @return true if there are changes
+                 */
+                inline bool         y_changes(size_t *first, size_t *count) const   { return get_changes(C_Y, first, count); }
+
+                /**
+                 * Mark all changes as processed
+                 */
+                void                advance();
         };
 
         namespace prop
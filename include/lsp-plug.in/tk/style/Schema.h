@@ -34,6 +34,7 @@
 #include <lsp-plug.in/io/IInStream.h>
 #include <lsp-plug.in/io/IInSequence.h>
 #include <lsp-plug.in/fmt/xml/PullParser.h>
+#include <lsp-plug.in/tk/util/TextCache.h>
 
 namespace lsp
 {
@@ -60,6 +61,7 @@ namespace lsp
                 {
                     S_CONFIGURING   = 1 << 0,       // Schema is in configuration state
                     S_INITIALIZED   = 1 << 1,       // Schema is initialized
+                    S_TRANSACTION   = 1 << 2,       // Schema is applying changes as a single transaction
                 };
 
                 typedef struct property_value_t
@@ -80,6 +82,7 @@ namespace lsp
                 Style                              *pRoot;
                 lltl::pphash<LSPString, Style>      vStyles;
                 lltl::pphash<LSPString, lsp::Color> vColors;
+                TextCache                           sTextCache;
 
                 prop::Float                         sScaling;
                 prop::Font                          sFont;
@@ -95,6 +98,8 @@ namespace lsp
                 void                bind(Style *root);
 
                 status_t            apply_internal(StyleSheet *sheet);
+                static status_t     order_styles(lltl::parray<Style> *list, Style *s);
+                status_t            complete_transaction();
 
             public:
                 explicit Schema(Atoms *atoms);
@@ -196,6 +201,22 @@ namespace lsp
                  * @return
                  */
                 inline bool         config_mode() const           { return nFlags & S_CONFIGURING;  }
+
+                /**
+                 * Check that schema is in transaction mode:
+                 *   - property changes are not propagated between styles
+                 *   - listeners are only marked for notification
+                 * All styles are synchronized and listeners are notified once
+                 * when the transaction is complete.
+                 * @return true if schema is in transaction mode
+                 */
+                inline bool         transaction_mode() const      { return nFlags & S_TRANSACTION;  }
+
+                /**
+                 * Get the cache of text measurements shared by all fonts of the schema
+                 * @return cache of text measurements
+                 */
+                inline TextCache   *text_cache()                  { return &sTextCache;             }
         };
     
     } /* namespace tk */
@@ -60,7 +60,8 @@ namespace lsp
                 enum style_flags_t
                 {
                     S_DELAYED           = 1 << 0,   // Delayed notification
-                    S_OVERRIDE          = 1 << 1    // Force overrides
+                    S_OVERRIDE          = 1 << 1,   // Force overrides
+                    S_VISITED           = 1 << 2    // Style has been visited by the schema traversal
                 };
 
                 typedef struct property_t
@@ -102,14 +103,22 @@ namespace lsp
                     Property           *pClient;
                 } client_t;
 
+                typedef struct cache_t
+                {
+                    atom_t              nId;        // Property identifier
+                    Style              *pOwner;     // Parent style that owns the property, NULL if not found
+                } cache_t;
+
             private:
                 lltl::parray<Style>             vParents;
                 lltl::parray<Style>             vChildren;
-                lltl::darray<property_t>        vProperties;
+                lltl::darray<property_t>        vProperties;    // Sorted by property identifier
+                lltl::darray<cache_t>           vCache;         // Resolution cache of parent properties, sorted by identifier
                 lltl::darray<listener_t>        vListeners;
                 lltl::parray<IStyleListener>    vLocks;
                 mutable Schema                 *pSchema;
                 size_t                          nFlags;
+                size_t                          nCacheStamp;    // Stamp of the last cache invalidation pass
 
             public:
                 explicit Style(Schema *schema);
@@ -124,7 +133,17 @@ namespace lsp
                 void                delayed_notify();
                 property_t         *get_property_recursive(atom_t id);
                 property_t         *get_parent_property(atom_t id);
+                property_t         *resolve_parent_property(atom_t id);
                 property_t         *get_property(atom_t id);
+                property_t         *alloc_property(atom_t id);
+                void                free_property(property_t *p);
+                size_t              property_index(atom_t id) const;
+                size_t              cache_index(atom_t id) const;
+                void                invalidate_cache();
+                void                invalidate_cache(size_t stamp);
+                void                invalidate_children_cache();
+                void                invalidate_children_cache(size_t stamp);
+                static size_t       next_cache_stamp();
                 status_t            set_property(atom_t id, property_t *src);
                 status_t            sync_property(property_t *p);
                 property_t         *create_property(atom_t id, const property_t *src, size_t flags);
@@ -137,6 +156,7 @@ namespace lsp
                 inline const property_t   *get_property_recursive(atom_t id) const { return const_cast<Style *>(this)->get_property_recursive(id); };
 
                 void                synchronize();
+                void                sync_properties();
                 void                notify_change(property_t *prop);
                 void                notify_children(property_t *prop);
                 size_t              notify_children_delayed(property_t *prop);
@@ -183,6 +203,14 @@ namespace lsp
                  */
                 bool                    config_mode() const;
 
+                /**
+                 * Check transaction mode of the schema: changes of properties
+                 * are not propagated to children and listeners are only marked
+                 * for notification until the transaction is complete
+                 * @return true if transaction mode
+                 */
+                bool                    transaction_mode() const;
+
                 /**
                  * Check sync mode
                  * @return true if sync mode
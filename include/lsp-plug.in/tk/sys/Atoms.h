@@ -40,8 +40,24 @@ namespace lsp
             private:
                 Atoms & operator = (const Atoms &);
 
+            protected:
+                typedef struct bucket_t
+                {
+                    size_t                  nHash;      // Hash code of the atom name
+                    atom_t                  nId;        // Atom identifier, negative if bucket is empty
+                } bucket_t;
+
             protected:
                 lltl::parray<char>      vAtoms;
+                bucket_t               *vIndex;         // Open-addressing hash index of atom names
+                size_t                  nCapacity;      // Capacity of the hash index, power of 2
+
+            protected:
+                static size_t       hash_name(const char *name);
+                bucket_t           *lookup(const char *name, size_t hash) const;
+                bool                grow_index();
+                bool                init_builtin(LSPString *key, size_t len, const char *postfix);
+                void                init_builtin();
 
             public:
                 explicit Atoms();
@@ -56,6 +72,13 @@ namespace lsp
                  */
                 atom_t              atom_id(const char *name);
 
+                /**
+                 * Find atom identifier by name without creating new atom
+                 * @param name atom name
+                 * @return atom identifier or negative error code
+                 */
+                atom_t              find_atom(const char *name) const;
+
                 /**
                  * Get atom identifier by name
                  * @param name atom name
@@ -63,6 +86,12 @@ namespace lsp
                  */
                 inline atom_t       atom_id(const LSPString *name)  { return atom_id(name->get_utf8());             }
 
+                /**
+                 * Get number of registered atoms
+                 * @return number of registered atoms
+                 */
+                inline size_t       size() const                    { return vAtoms.size();                         }
+
                 /**
                  * Get atom name by identifier
                  * @param name atom name or NULL
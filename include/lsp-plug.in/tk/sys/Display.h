@@ -33,12 +33,14 @@
 #include <lsp-plug.in/i18n/IDictionary.h>
 #include <lsp-plug.in/lltl/parray.h>
 #include <lsp-plug.in/ipc/Mutex.h>
+#include <lsp-plug.in/tk/util/SurfaceCache.h>
 
 namespace lsp
 {
     namespace tk
     {
         class Widget;
+        class Window;
         class SlotSet;
 
         /** Main display
@@ -51,13 +53,37 @@ namespace lsp
                 {
                     Widget         *widget;
                     char           *id;
+                    Widget         *pIndexed;   // The widget pointer the item is indexed with
+                    size_t          nHash;      // Hash code of the identifier
+                    size_t          nIndex;     // Index of the item in the list of widgets
+                    item_t         *pIdNext;    // Next item in the identifier hash bin
+                    item_t         *pPtrNext;   // Next item in the pointer hash bin
                 } item_t;
 
             protected:
                 lltl::parray<item_t>    sWidgets;
+                lltl::parray<item_t>    vPending;       // Items that have not been indexed by widget pointer yet
+                item_t                **vIdBins;        // Hash index of widgets by identifier
+                item_t                **vPtrBins;       // Hash index of widgets by pointer
+                size_t                  nBins;          // Number of bins in hash indexes, power of 2
                 lltl::parray<Widget>    vGarbage;
+                lltl::parray<Window>    vDirty;         // Windows that requested for the next frame
+                lltl::parray<Window>    vRendering;     // Windows that are rendered in the current frame
                 ipc::Mutex              sLock;
 
+                ws::taskid_t            nFrameTask;     // Identifier of the scheduled frame task
+                ws::timestamp_t         nLastFrame;     // The time of last rendered frame
+                size_t                  nFrameRate;     // Target frame rate
+                size_t                  nFrameError;    // Accumulated fractional part of the frame period
+                size_t                  nFrameStamp;    // Counter of rendered frames
+
+                Widget                 *pSurfHead;      // The least recently used widget that holds off-screen surface
+                Widget                 *pSurfTail;      // The most recently used widget that holds off-screen surface
+                lltl::parray<ws::ISurface> vSurfacePool;// Idle surfaces available for re-use
+                surface_stats_t         sSurfaceStats;  // Surface statistics
+                SurfaceCache            sSurfaceCache;  // Pre-rendered images shared between widgets
+                lltl::parray<ws::IWindow> vWindowPool;  // Idle native popup windows available for re-use
+
                 SlotSet                 sSlots;
                 Schema                  sSchema;
 
@@ -70,10 +96,29 @@ namespace lsp
             protected:
                 void                do_destroy();
                 void                garbage_collect();
+                bool                grow_index();
+                void                link_id(item_t *item);
+                void                link_ptr(item_t *item);
+                void                unlink_id(item_t *item);
+                void                unlink_ptr(item_t *item);
+                void                sync_pending();
+                item_t             *find_id(const char *id);
+                item_t             *find_ptr(const Widget *widget);
+                void                remove_item(item_t *item);
+                item_t             *add_item(const char *id);
                 status_t            init_schema();
+                void                schedule_frame();
+                void                render_frame(ws::timestamp_t time);
+                void                link_surface(Widget *widget);
+                bool                unlink_surface(Widget *widget);
+                void                evict_surfaces();
+                void                drop_surface_pool();
+                void                drop_window_pool();
 
             protected:
+                static inline size_t hash_ptr(const Widget *widget)  { return (size_t(widget) >> 4) * size_t(0x9e3779b1U); }
                 static status_t     main_task_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg);
+                static status_t     frame_task_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg);
 
             //---------------------------------------------------------------------------------
             // Construction and destruction
@@ -185,6 +230,91 @@ namespace lsp
                  */
                 inline bool exists(const char *id)          { return get(id) != NULL; }
 
+                /**
+                 * Allocate off-screen surface for the widget. The surface may be taken
+                 * from the pool of idle surfaces, in this case it is cleared before return.
+                 * Surfaces of widgets that were not rendered in the current frame
+                 * may be evicted if the memory limit is exceeded. Widgets that keep state
+                 * in their surfaces are notified by Widget::surface_created() on re-allocation.
+                 *
+                 * @param widget widget that will own the surface
+                 * @param s the base surface used to create new surfaces
+                 * @param width width of the surface
+                 * @param height height of the surface
+                 * @return allocated surface or NULL
+                 */
+                ws::ISurface       *alloc_surface(Widget *widget, ws::ISurface *s, size_t width, size_t height);
+
+                /**
+                 * Release off-screen surface previously allocated for the widget
+                 *
+                 * @param widget widget that owns the surface
+                 * @param surface surface to release
+                 */
+                void                release_surface(Widget *widget, ws::ISurface *surface);
+
+                /**
+                 * Mark off-screen surface of the widget as the most recently used one
+                 *
+                 * @param widget widget that owns the surface
+                 */
+                void                touch_surface(Widget *widget);
+
+                /**
+                 * Get the stamp of the currently rendered frame
+                 * @return the stamp of the currently rendered frame
+                 */
+                inline size_t       frame_stamp() const         { return nFrameStamp;       }
+
+                /**
+                 * Set memory limit for off-screen surfaces of widgets
+                 * @param limit memory limit in bytes, zero for unlimited
+                 */
+                void                set_surface_limit(wsize_t limit);
+
+                /**
+                 * Get memory limit for off-screen surfaces of widgets
+                 * @return memory limit in bytes, zero if unlimited
+                 */
+                inline wsize_t      surface_limit() const       { return sSurfaceStats.nLimit;  }
+
+                /**
+                 * Get statistics of off-screen surfaces
+                 * @param stats pointer to store statistics
+                 */
+                void                get_surface_stats(surface_stats_t *stats) const;
+
+                /**
+                 * Acquire native window for the popup. The window is taken from the pool
+                 * of idle windows if there is a suitable one, otherwise new window is created
+                 * and initialized. The returned window is hidden and has no event handler.
+                 *
+                 * @param screen screen the window should be shown on
+                 * @return native window or NULL on error
+                 */
+                ws::IWindow        *acquire_window(size_t screen);
+
+                /**
+                 * Release native window previously acquired with acquire_window().
+                 * The window is hidden and kept in the pool of idle windows
+                 * for further re-use or destroyed if the pool is full.
+                 *
+                 * @param wnd native window to release
+                 */
+                void                release_window(ws::IWindow *wnd);
+
+                /**
+                 * Get the cache of pre-rendered images shared between widgets
+                 * @return cache of pre-rendered images
+                 */
+                inline SurfaceCache *surface_cache()            { return &sSurfaceCache;    }
+
+                /**
+                 * Get the cache of text measurements
+                 * @return cache of text measurements
+                 */
+                inline TextCache    *text_cache()               { return sSchema.text_cache(); }
+
                 /**
                  * Lock the main event loop until unlock() is called
                  * @return true if main event loop has been locked
@@ -203,6 +333,34 @@ namespace lsp
                  */
                 inline bool unlock()                        { return sLock.unlock();    }
 
+                /**
+                 * Request the window to be rendered at the next frame. Requests from all
+                 * windows are coalesced and executed at the rate not greater than the target
+                 * frame rate. If there are no requests, the display does not wake up.
+                 *
+                 * @param wnd window to render
+                 * @return status of operation
+                 */
+                status_t request_frame(Window *wnd);
+
+                /**
+                 * Cancel previously submitted frame request for the window
+                 * @param wnd window to cancel the request
+                 */
+                void cancel_frame(Window *wnd);
+
+                /**
+                 * Set the target frame rate of the display
+                 * @param rate target frame rate in frames per second, zero for default
+                 */
+                void set_frame_rate(size_t rate);
+
+                /**
+                 * Get the target frame rate of the display
+                 * @return target frame rate in frames per second
+                 */
+                inline size_t frame_rate() const            { return nFrameRate;        }
+
             //---------------------------------------------------------------------------------
             // Properties
             public:
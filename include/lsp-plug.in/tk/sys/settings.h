@@ -45,6 +45,16 @@ namespace lsp
              */
             resource::Environment  *environment;
 
+            /**
+             * Target frame rate of the display, zero for default value
+             */
+            size_t                  frame_rate;
+
+            /**
+             * Memory limit for off-screen surfaces of widgets in bytes, zero if unlimited
+             */
+            size_t                  surface_limit;
+
             /**
              * Default constructor
              */
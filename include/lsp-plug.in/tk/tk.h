@@ -127,6 +127,9 @@
 
 // Utilitary objects
 #include <lsp-plug.in/tk/util/KeyboardHandler.h>
+#include <lsp-plug.in/tk/util/ScratchBuffer.h>
+#include <lsp-plug.in/tk/util/SurfaceCache.h>
+#include <lsp-plug.in/tk/util/TextCache.h>
 #include <lsp-plug.in/tk/util/TextCursor.h>
 #include <lsp-plug.in/tk/util/TextDataSink.h>
 #include <lsp-plug.in/tk/util/TextDataSource.h>
@@ -191,6 +194,7 @@
 #include <lsp-plug.in/tk/widgets/graph/GraphFrameBuffer.h>
 #include <lsp-plug.in/tk/widgets/graph/GraphMarker.h>
 #include <lsp-plug.in/tk/widgets/graph/GraphMesh.h>
+#include <lsp-plug.in/tk/widgets/graph/GraphMeshSet.h>
 #include <lsp-plug.in/tk/widgets/graph/GraphOrigin.h>
 #include <lsp-plug.in/tk/widgets/graph/GraphText.h>
 
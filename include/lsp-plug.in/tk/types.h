@@ -38,6 +38,15 @@
 #define LSP_TK_ENV_CONFIG               "configuration"
 #define LSP_TK_ENV_CONFIG_DFL           "lsp-tk"
 
+// The default frame rate of the display
+#define LSP_TK_FRAME_RATE_DFL           60
+// The maximum frame rate of the display
+#define LSP_TK_FRAME_RATE_MAX           1000
+// The maximum number of idle surfaces kept by display for further re-use
+#define LSP_TK_SURFACE_POOL_MAX         16
+// The maximum number of idle native popup windows kept by display for further re-use
+#define LSP_TK_WINDOW_POOL_MAX          4
+
 namespace lsp
 {
     namespace tk
@@ -145,6 +154,15 @@ namespace lsp
             GFF_DEFAULT = GFF_RAINBOW   //!< GFF_DEFAULT default function
         };
 
+        /**
+         * Rendering layer of the graph item
+         */
+        enum graph_layer_t
+        {
+            GL_STATIC,                  //!< GL_STATIC rarely changing items: axes, markers, text
+            GL_DYNAMIC                  //!< GL_DYNAMIC frequently changing items: meshes, frame buffers, dots
+        };
+
         typedef struct w_class_t
         {
             const char         *name;
@@ -166,6 +184,22 @@ namespace lsp
             bool                bStretch;       // Stretch parameters
         } arrangement_t;
 
+        /**
+         * Statistics of off-screen surfaces allocated by widgets
+         */
+        typedef struct surface_stats_t
+        {
+            size_t              nSurfaces;      // Number of surfaces currently used by widgets
+            size_t              nPooled;        // Number of idle surfaces kept for re-use
+            wsize_t             nBytes;         // Memory used by widget surfaces, in bytes
+            wsize_t             nPoolBytes;     // Memory used by idle surfaces, in bytes
+            wsize_t             nPeakBytes;     // Peak memory used by all surfaces, in bytes
+            wsize_t             nLimit;         // Memory limit for all surfaces, zero if unlimited
+            size_t              nAllocated;     // Overall number of surfaces created
+            size_t              nReused;        // Overall number of surfaces taken from the pool
+            size_t              nEvicted;       // Overall number of surfaces evicted from widgets
+        } surface_stats_t;
+
         /**
          * File dialog mode
          */
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_TK_UTIL_SCRATCHBUFFER_H_
+#define LSP_PLUG_IN_TK_UTIL_SCRATCHBUFFER_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * Grow-only aligned floating-point buffer that can be kept by widgets
+         * between draw calls to avoid heap allocations at each redraw
+         */
+        class ScratchBuffer
+        {
+            private:
+                ScratchBuffer & operator = (const ScratchBuffer &);
+                ScratchBuffer(const ScratchBuffer &);
+
+            protected:
+                float          *vData;          // Aligned pointer to the data
+                uint8_t        *pData;          // Allocated memory chunk
+                size_t          nCapacity;      // Capacity in floats
+                size_t          nAllocations;   // Number of performed allocations
+
+            public:
+                explicit ScratchBuffer();
+                ~ScratchBuffer();
+
+            public:
+                /**
+                 * Get the buffer of at least the specified number of floats,
+                 * memory is re-allocated only if the current capacity is not enough
+                 * @param count number of floats
+                 * @return pointer to the buffer or NULL if there is not enough memory
+                 */
+                float          *get(size_t count);
+
+                /**
+                 * Free the allocated memory
+                 */
+                void            flush();
+
+                inline size_t   capacity() const        { return nCapacity;     }
+                inline size_t   allocations() const     { return nAllocations;  }
+        };
+    }
+}
+
+#endif /* LSP_PLUG_IN_TK_UTIL_SCRATCHBUFFER_H_ */
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_TK_UTIL_SURFACECACHE_H_
+#define LSP_PLUG_IN_TK_UTIL_SURFACECACHE_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/ws/ISurface.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * Cache of pre-rendered images shared between widgets. Each image is
+         * identified by the binary key that should contain all parameters that
+         * affect the image contents. The least recently used images are evicted
+         * when the number of cached images exceeds the limit.
+         */
+        class SurfaceCache
+        {
+            private:
+                SurfaceCache & operator = (const SurfaceCache &);
+                SurfaceCache(const SurfaceCache &);
+
+            protected:
+                typedef struct item_t
+                {
+                    ws::ISurface   *pSurface;       // Cached surface
+                    size_t          nSize;          // Size of the key
+                    uint8_t        *vKey;           // Key data, stored right after the item
+                } item_t;
+
+            protected:
+                lltl::parray<item_t>    vItems;     // Items, the most recently used item is the last one
+                size_t                  nLimit;     // Maximum number of cached items
+
+            protected:
+                static void     destroy_item(item_t *item);
+                void            evict(size_t limit);
+
+            public:
+                explicit SurfaceCache();
+                ~SurfaceCache();
+
+            public:
+                /**
+                 * Lookup for the cached surface
+                 * @param key the key data
+                 * @param size the size of the key data
+                 * @return cached surface or NULL if there is no surface for the key
+                 */
+                ws::ISurface   *get(const void *key, size_t size);
+
+                /**
+                 * Put the surface to the cache, the cache takes ownership on the surface.
+                 * Previously cached surface with the same key is destroyed.
+                 * @param key the key data
+                 * @param size the size of the key data
+                 * @param surface surface to store
+                 * @return status of operation, the surface is destroyed on error
+                 */
+                status_t        put(const void *key, size_t size, ws::ISurface *surface);
+
+                /**
+                 * Destroy all cached surfaces
+                 */
+                void            flush();
+
+                /**
+                 * Set maximum number of cached surfaces
+                 * @param limit maximum number of cached surfaces
+                 */
+                void            set_limit(size_t limit);
+
+                inline size_t   limit() const           { return nLimit;            }
+                inline size_t   size() const            { return vItems.size();     }
+        };
+    }
+}
+
+#endif /* LSP_PLUG_IN_TK_UTIL_SURFACECACHE_H_ */
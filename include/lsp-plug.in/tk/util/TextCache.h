@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_TK_UTIL_TEXTCACHE_H_
+#define LSP_PLUG_IN_TK_UTIL_TEXTCACHE_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/ws/ISurface.h>
+#include <lsp-plug.in/runtime/LSPString.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * Cache of text measurements. Each record is identified by the font name,
+         * font size, font flags and the measured text. The least recently used
+         * records are evicted when the number of records exceeds the limit.
+         */
+        class TextCache
+        {
+            private:
+                TextCache & operator = (const TextCache &);
+                TextCache(const TextCache &);
+
+            protected:
+                enum const_t
+                {
+                    BINS        = 1024          // Number of hash bins, power of 2
+                };
+
+                typedef struct item_t
+                {
+                    item_t                 *pPrev;      // Previous item in the LRU list
+                    item_t                 *pNext;      // Next item in the LRU list
+                    item_t                 *pBinNext;   // Next item in the hash bin
+                    size_t                  nHash;      // Hash of the key
+                    float                   fSize;      // Font size
+                    size_t                  nFlags;     // Font flags
+                    size_t                  nName;      // Length of the font name in bytes
+                    size_t                  nText;      // Length of the text in characters
+                    char                   *sName;      // Font name
+                    lsp_wchar_t            *vText;      // Text characters
+                    ws::text_parameters_t   sParams;    // Cached text parameters
+                } item_t;
+
+            protected:
+                item_t                **vBins;      // Hash bins
+                item_t                 *pHead;      // The most recently used item
+                item_t                 *pTail;      // The least recently used item
+                size_t                  nItems;     // Number of items
+                size_t                  nLimit;     // Maximum number of items
+                size_t                  nHits;      // Number of cache hits
+                size_t                  nMisses;    // Number of cache misses
+
+            protected:
+                static size_t   hash_key(const char *name, size_t nlen, float size, size_t flags, const lsp_wchar_t *text, size_t tlen);
+                static bool     normalize(const LSPString *text, ssize_t *first, ssize_t *last);
+                item_t         *find(const ws::Font *f, const LSPString *text, ssize_t first, ssize_t last, size_t *hash);
+                void            unlink(item_t *item);
+                void            link_first(item_t *item);
+                void            remove(item_t *item);
+                void            evict(size_t limit);
+
+            public:
+                explicit TextCache();
+                ~TextCache();
+
+            public:
+                /**
+                 * Lookup for the cached text parameters
+                 * @param f font
+                 * @param tp pointer to store text parameters
+                 * @param text text
+                 * @param first index of the first character
+                 * @param last index of the character after the last one
+                 * @return true if parameters were found in the cache
+                 */
+                bool            get(const ws::Font *f, ws::text_parameters_t *tp, const LSPString *text, ssize_t first, ssize_t last);
+
+                /**
+                 * Store text parameters to the cache
+                 * @param f font
+                 * @param tp text parameters to store
+                 * @param text text
+                 * @param first index of the first character
+                 * @param last index of the character after the last one
+                 * @return status of operation
+                 */
+                status_t        put(const ws::Font *f, const ws::text_parameters_t *tp, const LSPString *text, ssize_t first, ssize_t last);
+
+                /**
+                 * Get text parameters from the cache or measure the text with the surface
+                 * and store the result in the cache
+                 * @param s surface used to measure the text
+                 * @param f font
+                 * @param tp pointer to store text parameters
+                 * @param text text
+                 * @param first index of the first character
+                 * @param last index of the character after the last one
+                 * @return true on success
+                 */
+                bool            measure(ws::ISurface *s, const ws::Font *f, ws::text_parameters_t *tp, const LSPString *text, ssize_t first, ssize_t last);
+
+                /**
+                 * Drop all cached records
+                 */
+                void            flush();
+
+                /**
+                 * Set maximum number of cached records
+                 * @param limit maximum number of cached records
+                 */
+                void            set_limit(size_t limit);
+
+                /**
+                 * Reset hit and miss counters
+                 */
+                void            reset_stats();
+
+                inline size_t   limit() const           { return nLimit;            }
+                inline size_t   size() const            { return nItems;            }
+                inline size_t   hits() const            { return nHits;             }
+                inline size_t   misses() const          { return nMisses;           }
+        };
+    }
+}
+
+#endif /* LSP_PLUG_IN_TK_UTIL_TEXTCACHE_H_ */
@@ -55,6 +55,8 @@ namespace lsp
             private:
                 Widget & operator = (const Widget &);
 
+                friend class Display;
+
             public:
                 static const w_class_t    metadata;
 
@@ -67,7 +69,8 @@ namespace lsp
                     REDRAW_CHILD    = 1 << 3,       // Need to redraw child only
                     SIZE_INVALID    = 1 << 4,       // Size limit structure is valid
                     RESIZE_PENDING  = 1 << 5,       // The resize request is pending
-                    REALIZE_ACTIVE  = 1 << 6        // Realize is active, no need to trigger for realize
+                    REALIZE_ACTIVE  = 1 << 6,       // Realize is active, no need to trigger for realize
+                    REALIZE_MOVE    = 1 << 7        // Realize only moves widgets, contents of surfaces remain valid
                 };
 
             protected:
@@ -87,6 +90,9 @@ namespace lsp
                 Display            *pDisplay;       // Pointer to display
                 Widget             *pParent;        // Parent widget
                 ws::ISurface       *pSurface;       // Drawing surface
+                size_t              nSurfaceStamp;  // The frame stamp of the last surface access
+                Widget             *pSurfPrev;      // Less recently used widget that holds a surface
+                Widget             *pSurfNext;      // More recently used widget that holds a surface
 
                 ws::size_limit_t    sLimit;         // Cached pre-computed size limit
                 ws::rectangle_t     sSize;          // Real allocated geometry of widget
@@ -132,6 +138,7 @@ namespace lsp
             // Interface for nested classes
             protected:
                 void                    do_destroy();
+                void                    drop_surface();
 
                 void                    unlink_widget(Widget *widget);
 
@@ -150,6 +157,14 @@ namespace lsp
                  */
                 virtual void            size_request(ws::size_limit_t *r);
 
+                /**
+                 * Callback on call when new surface has been allocated for the widget.
+                 * The contents of the previous surface are lost, so all state that relies
+                 * on them should be reset. The surface will be completely redrawn after the call.
+                 * @param s new surface of the widget
+                 */
+                virtual void            surface_created(ws::ISurface *s);
+
                 /**
                  * Realize widget internally
                  * @param r real area allocated to the widget
@@ -54,6 +54,32 @@ namespace lsp
             LSP_TK_STYLE_DEF_END
         }
 
+        /**
+         * Data model of the list box. When the model is set, the list box operates in
+         * the virtual mode: it does not use ListBoxItem widgets and requests the text
+         * only for the visible rows. All rows have the same height.
+         */
+        class IListBoxModel
+        {
+            public:
+                virtual ~IListBoxModel();
+
+            public:
+                /**
+                 * Get number of rows in the model
+                 * @return number of rows
+                 */
+                virtual size_t          size();
+
+                /**
+                 * Format the text of the row
+                 * @param dst destination string to store the text
+                 * @param index index of the row
+                 * @return status of operation
+                 */
+                virtual status_t        format(LSPString *dst, size_t index);
+        };
+
         class ListBox: public WidgetContainer
         {
             private:
@@ -114,7 +140,8 @@ namespace lsp
                 {
                     F_SEL_ACTIVE        = 1 << 0,
                     F_SUBMIT            = 1 << 1,
-                    F_CHANGED           = 1 << 2
+                    F_CHANGED           = 1 << 2,
+                    F_ROWS_RESIZE       = 1 << 3        // Realized rows require more width, resize after realize
                 };
 
             protected:
@@ -130,6 +157,13 @@ namespace lsp
                 ws::rectangle_t                 sArea;
                 ws::rectangle_t                 sList;
                 lltl::darray<item_t>            vVisible;
+                size_t                          nTextSerial;    // Serial number of the cached text sizes of items
+
+                IListBoxModel                  *pModel;         // Data model for the virtual mode
+                ListBoxItem                     sRow;           // Row template for the virtual mode
+                lltl::darray<size_t>            vRowSelected;   // Selected rows in the virtual mode, sorted
+                ssize_t                         nRowHeight;     // Height of each row in the virtual mode
+                ssize_t                         nRowWidth;      // Maximum width of the measured rows in the virtual mode
 
                 prop::WidgetList<ListBoxItem>   vItems;
                 prop::WidgetSet<ListBoxItem>    vSelected;
@@ -165,6 +199,15 @@ namespace lsp
                 status_t                on_key_scroll();
                 bool                    scroll_to_item(ssize_t vindex);
 
+                size_t                  visible_count();
+                ssize_t                 visible_index(ssize_t index);
+                ssize_t                 item_index(ssize_t vindex);
+                bool                    visible_rect(ws::rectangle_t *r, ssize_t vindex);
+                ssize_t                 find_row(ssize_t x, ssize_t y);
+                ssize_t                 row_index(size_t index);
+                void                    realize_rows();
+                void                    render_rows(ws::ISurface *s, const ws::rectangle_t *area, float scaling);
+
             protected:
                 static status_t         slot_on_scroll_change(Widget *sender, void *ptr, void *data);
                 static status_t         slot_on_change(Widget *sender, void *ptr, void *data);
@@ -215,6 +258,56 @@ namespace lsp
                 LSP_TK_PROPERTY(Integer,            hscroll_spacing,            &sHScrollSpacing)
                 LSP_TK_PROPERTY(Integer,            vscroll_spacing,            &sVScrollSpacing)
 
+                /**
+                 * Get the row template used for rendering rows in the virtual mode,
+                 * may be used to configure padding and colors of rows
+                 * @return row template
+                 */
+                inline ListBoxItem                 *row_template()              { return &sRow;         }
+
+            public:
+                /**
+                 * Set data model and switch the list box to the virtual mode
+                 * @param model data model or NULL to use ListBoxItem widgets
+                 */
+                void                        set_model(IListBoxModel *model);
+
+                /**
+                 * Get data model
+                 * @return data model or NULL if the list box does not operate in the virtual mode
+                 */
+                inline IListBoxModel       *model()                             { return pModel;        }
+
+                /**
+                 * Notify the list box that the data of the model has changed
+                 */
+                void                        model_changed();
+
+                /**
+                 * Check that the row is selected in the virtual mode
+                 * @param index index of the row
+                 * @return true if the row is selected
+                 */
+                bool                        row_selected(size_t index);
+
+                /**
+                 * Select the row in the virtual mode
+                 * @param index index of the row
+                 * @param add add row to the selection instead of replacing the selection
+                 */
+                void                        select_row(size_t index, bool add);
+
+                /**
+                 * Clear selection of rows in the virtual mode
+                 */
+                void                        clear_rows();
+
+                /**
+                 * Get the list of selected rows in the virtual mode
+                 * @return list of selected rows sorted in ascending order
+                 */
+                inline const lltl::darray<size_t>  *selected_rows() const       { return &vRowSelected; }
+
             public:
                 virtual Widget             *find_widget(ssize_t x, ssize_t y);
 
@@ -226,6 +319,8 @@ namespace lsp
 
                 virtual void                render(ws::ISurface *s, const ws::rectangle_t *area, bool force);
 
+                virtual status_t            on_realized(const ws::rectangle_t *r);
+
                 virtual status_t            on_mouse_down(const ws::event_t *e);
 
                 virtual status_t            on_mouse_up(const ws::event_t *e);
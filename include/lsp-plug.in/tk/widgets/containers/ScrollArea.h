@@ -71,6 +71,10 @@ namespace lsp
                 ScrollBar               sHBar;
                 ScrollBar               sVBar;
                 ws::rectangle_t         sArea;
+                ws::ISurface           *pScrollBuf;     // Buffer used for scrolling the contents of viewport
+                ws::rectangle_t         sViewport;      // Viewport at the last full render
+                ws::rectangle_t         sRendered;      // Location of the child widget at the last full render
+                bool                    bRendered;      // The viewport contents are valid for scrolling
 
                 prop::Layout            sLayout;
                 prop::SizeConstraints   sSizeConstraints;
@@ -82,6 +86,9 @@ namespace lsp
             protected:
                 void                    do_destroy();
                 void                    estimate_size(alloc_t *a, const ws::rectangle_t *xr);
+                void                    render_child(ws::ISurface *s, const ws::rectangle_t *area, bool force);
+                bool                    scroll_viewport(ws::ISurface *s, const ws::rectangle_t *vp);
+                void                    drop_scroll_buffer();
 
                 static status_t         slot_on_scroll_change(Widget *sender, void *ptr, void *data);
 
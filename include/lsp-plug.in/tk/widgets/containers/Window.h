@@ -27,6 +27,7 @@
 #endif
 
 #include <lsp-plug.in/ws/IWindow.h>
+#include <lsp-plug.in/lltl/darray.h>
 
 namespace lsp
 {
@@ -77,6 +78,12 @@ namespace lsp
             public:
                 static const w_class_t    metadata;
 
+            protected:
+                enum damage_t
+                {
+                    DAMAGE_MAX_RECTS    = 16            // Maximum number of damaged rectangles before merging them
+                };
+
             protected:
                 ws::IWindow            *pWindow;            // Underlying window
                 void                   *pNativeHandle;      // Native handle of the window
@@ -90,7 +97,10 @@ namespace lsp
                 key_handler_t           hKeys;              // Key handler
 
                 Window                 *pActor;
-                Timer                   sRedraw;
+
+                lltl::darray<ws::rectangle_t>   vDamage;    // List of damaged rectangles to commit
+                size_t                  nPixelsSaved;       // Number of pixels not transferred at last frame
+                wsize_t                 nPixelsTotal;       // Total number of pixels not transferred
 
                 prop::String            sTitle;
                 prop::String            sRole;
@@ -108,11 +118,11 @@ namespace lsp
             //---------------------------------------------------------------------------------
             // Slot handlers
             protected:
-                static status_t     tmr_redraw_request(ws::timestamp_t sched, ws::timestamp_t ts, void *args);
                 static status_t     slot_window_close(Widget *sender, void *ptr, void *data);
 
                 status_t            do_render();
                 void                do_destroy();
+                void                damage_widget(Widget *w);
                 virtual status_t    sync_size();
                 status_t            update_pointer();
 
@@ -179,6 +189,27 @@ namespace lsp
 
                 inline bool                     override_pointer() const    { return bOverridePointer; }
 
+                /**
+                 * Get number of pixels that were not transferred to the native window
+                 * at the last frame thanks to the damage tracking
+                 * @return number of pixels saved at the last frame
+                 */
+                inline size_t                   pixels_saved() const        { return nPixelsSaved; }
+
+                /**
+                 * Get total number of pixels that were not transferred to the native window
+                 * since the window has been created
+                 * @return total number of pixels saved
+                 */
+                inline wsize_t                  pixels_saved_total() const  { return nPixelsTotal; }
+
+                /**
+                 * Mark the area of the window as damaged, it will be transferred
+                 * to the native window at the next frame
+                 * @param r damaged area in window coordinates
+                 */
+                void                            damage_area(const ws::rectangle_t *r);
+
             public:
                 LSP_TK_PROPERTY(String,             title,              &sTitle)
                 LSP_TK_PROPERTY(String,             role,               &sRole)
@@ -198,6 +229,10 @@ namespace lsp
             public:
                 virtual void            render(ws::ISurface *s, const ws::rectangle_t *area, bool force);
 
+                virtual void            query_draw(size_t flags = REDRAW_SURFACE);
+
+                virtual void            query_resize();
+
                 virtual status_t        override_pointer(bool override = true);
 
                 /** Show window
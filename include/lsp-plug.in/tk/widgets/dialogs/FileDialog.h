@@ -28,6 +28,8 @@
 
 #include <lsp-plug.in/fmt/bookmarks.h>
 #include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/ipc/Mutex.h>
+#include <lsp-plug.in/ipc/Thread.h>
 
 namespace lsp
 {
@@ -71,12 +73,86 @@ namespace lsp
                     F_ISHIDDEN  = 1 << 6
                 };
 
+                enum scan_flags_t
+                {
+                    SCAN_CACHED     = 1 << 0,       // Cached listing is shown while scanning
+                    SCAN_SYNC       = 1 << 1        // Scanner has been run synchronously, there is no thread to join
+                };
+
                 typedef struct f_entry_t
                 {
                     LSPString               sName;
                     size_t                  nFlags;
+                    ListBoxItem            *pItem;      // List item reused between filter updates
                 } f_entry_t;
 
+                typedef struct filter_t
+                {
+                    LSPString               sText;      // Search text
+                    io::PathPattern         sPattern;   // Compiled search pattern
+                    lltl::darray<size_t>    vIndexes;   // Indexes of matching entries in the list of files
+                } filter_t;
+
+                typedef struct dir_cache_t
+                {
+                    LSPString               sPath;      // Path to the directory
+                    wsize_t                 nMTime;     // Modification time of the directory
+                    lltl::parray<f_entry_t> vFiles;     // Cached listing of the directory
+                } dir_cache_t;
+
+                /**
+                 * Directory scanner, reads the directory contents in a separate thread
+                 * and passes found entries to the dialog in batches
+                 */
+                class DirScanner: public ipc::Thread
+                {
+                    private:
+                        DirScanner & operator = (const DirScanner &);
+
+                    protected:
+                        ipc::Mutex              sLock;
+                        io::Path                sPath;          // Directory to scan
+                        lltl::parray<f_entry_t> vBatch;         // Entries not fetched by the dialog yet
+                        wsize_t                 nMTime;         // Modification time of the directory
+                        wsize_t                 nCachedMTime;   // Modification time of the cached listing
+                        status_t                nResult;        // Result of the scan
+                        bool                    bCached;        // Cached listing is present
+                        volatile bool           bCancelled;     // Scan has been cancelled
+                        volatile bool           bCompleted;     // Scan has been completed
+                        bool                    bUnchanged;     // Directory has not changed since the cached scan
+
+                    protected:
+                        bool                    submit(lltl::parray<f_entry_t> *batch);
+                        void                    complete(status_t result, bool unchanged);
+
+                    public:
+                        explicit DirScanner();
+                        virtual ~DirScanner();
+
+                    public:
+                        status_t                init(const io::Path *path, const dir_cache_t *cache);
+                        virtual status_t        run();
+
+                    public:
+                        /**
+                         * Request the scan to stop as soon as possible, does not wait for the thread
+                         */
+                        void                    stop();
+
+                        /**
+                         * Move all entries scanned since the previous call to the list
+                         * @param dst destination list to append entries
+                         * @return true if the scan has been completed and all entries were fetched
+                         */
+                        bool                    fetch(lltl::parray<f_entry_t> *dst);
+
+                        inline bool             completed() const   { return bCompleted;    }
+                        inline bool             unchanged() const   { return bUnchanged;    }
+                        inline status_t         result() const      { return nResult;       }
+                        inline wsize_t          mtime() const       { return nMTime;        }
+                        inline const io::Path  *path() const        { return &sPath;        }
+                };
+
                 typedef struct bm_entry_t
                 {
                     Hyperlink               sHlink;
@@ -116,6 +192,14 @@ namespace lsp
                 lltl::parray<Widget>        vWidgets;
                 lltl::parray<bm_entry_t>    vBookmarks;
                 lltl::parray<f_entry_t>     vFiles;
+                lltl::parray<f_entry_t>     vScanned;       // Scanned entries while cached listing is shown
+                lltl::parray<dir_cache_t>   vDirCache;      // Listing cache, most recently used first
+                lltl::parray<DirScanner>    vRetired;       // Cancelled scanners which threads are still running
+                lltl::parray<filter_t>      vFilters;       // Stack of filters, each next one narrows the previous
+                ssize_t                     nFilterTag;     // Tag of the file mask the filters have been built for
+                DirScanner                 *pScanner;       // Active directory scanner
+                size_t                      nScanFlags;     // Scan flags
+                Timer                       sScanTimer;     // Timer to fetch the scan results
 
                 bm_entry_t                 *pSelBookmark;
                 bm_entry_t                 *pPopupBookmark;
@@ -222,15 +306,30 @@ namespace lsp
                 status_t                add_new_bookmark();
                 status_t                init_bookmark_entry(bm_entry_t *ent, const io::Path *path);
 
-                void                    destroy_file_entries(lltl::parray<f_entry_t> *list);
+                static void             destroy_file_entries(lltl::parray<f_entry_t> *list);
                 status_t                refresh_current_path();
-                status_t                add_file_entry(lltl::parray<f_entry_t> *dst, const char *name, size_t flags);
-                status_t                add_file_entry(lltl::parray<f_entry_t> *dst, const LSPString *name, size_t flags);
+                static status_t         add_file_entry(lltl::parray<f_entry_t> *dst, const char *name, size_t flags);
+                static status_t         add_file_entry(lltl::parray<f_entry_t> *dst, const LSPString *name, size_t flags);
+                static status_t         copy_file_entries(lltl::parray<f_entry_t> *dst, const lltl::parray<f_entry_t> *src);
                 static int              cmp_file_entry(const f_entry_t *a, const f_entry_t *b);
                 f_entry_t              *selected_entry();
 
                 status_t                sync_filters();
                 status_t                apply_filters();
+                void                    drop_filters();
+                filter_t               *select_filter(const LSPString *text, const FileMask *fmask);
+                bool                    merge_file_entries(size_t first);
+                ListBoxItem            *create_file_item(f_entry_t *ent);
+                void                    destroy_files();
+
+                status_t                sync_scan();
+                void                    cancel_scan();
+                void                    reap_scanners(bool wait);
+                void                    drop_dir_cache();
+                dir_cache_t            *find_dir_cache(const LSPString *path);
+                status_t                update_dir_cache(const LSPString *path, wsize_t mtime);
+                void                    show_access_error(status_t code);
+                static status_t         scan_timer_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg);
 
             protected:
                 virtual void            property_changed(Property *prop);
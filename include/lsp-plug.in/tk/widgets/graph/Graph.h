@@ -77,6 +77,9 @@ namespace lsp
                 prop::Padding                   sIPadding;      // Internal padding
 
                 ws::ISurface                   *pGlass;         // Cached glass gradient
+                ws::ISurface                   *pStatic;        // Cached static layer
+                size_t                          nStatic;        // Number of leading items cached in the static layer
+                bool                            bStatic;        // Static layer is up to date
                 ws::rectangle_t                 sCanvas;        // Actual dimensions of the drawing area (with padding)
                 ws::rectangle_t                 sICanvas;       // Actual dimensions of the drawing area (without padding)
 
@@ -95,6 +98,9 @@ namespace lsp
 
                 void                        sync_lists();
                 void                        drop_glass();
+                void                        drop_static();
+                size_t                      static_items();
+                void                        render_items(ws::ISurface *s, size_t first, size_t last);
 
             public:
                 explicit Graph(Display *dpy);
@@ -140,6 +146,13 @@ namespace lsp
                  */
                 GraphOrigin                *origin(size_t index)        { return vOrigins.get(index);   }
 
+                /**
+                 * Query redraw of the specific layer of the graph
+                 *
+                 * @param layer layer to redraw
+                 */
+                void                        query_layer_draw(graph_layer_t layer);
+
                 bool                        origin(size_t index, float *x, float *y);
                 bool                        origin(GraphOrigin *o, float *x, float *y);
 
@@ -65,9 +65,32 @@ namespace lsp
                 prop::Integer               sOrigin;        // Origin index
                 prop::Color                 sColor;         // Color of the axis
 
+            protected:
+                typedef struct transform_t
+                {
+                    ws::rectangle_t             sCanvas;        // Canvas the transform was computed for
+                    float                       fCX;            // Horizontal coordinate of the origin
+                    float                       fCY;            // Vertical coordinate of the origin
+                    float                       fDX;            // Horizontal projection of the direction
+                    float                       fDY;            // Vertical projection of the direction
+                    float                       fLength;        // Length of the axis, negative if not computable
+                    float                       fMin;           // Minimum absolute value
+                    float                       fMax;           // Maximum absolute value
+                    float                       fNorm;          // Normalizing factor, zero if transform is not possible
+                    bool                        bLog;           // Logarithmic scale
+                    bool                        bValid;         // Transform is valid
+                } transform_t;
+
+            protected:
+                transform_t                 sTransform;     // Cached transform
+                size_t                      nSerial;        // Serial number of the cached transform
+
             protected:
                 virtual void                property_changed(Property *prop);
 
+                const transform_t          *sync_transform(Graph *cv);
+                void                        apply_transform(const transform_t *t, float *x, float *y, const float *dv, size_t count);
+
             public:
                 explicit GraphAxis(Display *dpy);
                 virtual ~GraphAxis();
@@ -86,8 +109,37 @@ namespace lsp
                 LSP_TK_PROPERTY(Color,              color,                  &sColor);
 
             public:
+                /**
+                 * Apply the axis transform to the data and add the result to the coordinates
+                 *
+                 * @param x horizontal coordinates
+                 * @param y vertical coordinates
+                 * @param dv values to apply
+                 * @param count number of values
+                 * @return true if the transform has been applied
+                 */
                 bool                        apply(float *x, float *y, const float *dv, size_t count);
+
+                /**
+                 * Apply the axis transform to several series of data in one call
+                 *
+                 * @param x array of pointers to horizontal coordinates of each series
+                 * @param y array of pointers to vertical coordinates of each series
+                 * @param dv array of pointers to values of each series
+                 * @param count number of values in each series
+                 * @param series number of series
+                 * @return true if the transform has been applied
+                 */
+                bool                        apply(float * const *x, float * const *y, const float * const *dv, size_t count, size_t series);
                 float                       project(float x, float y);
+
+                /**
+                 * Get the identifier of the current axis transform, valid only at render time.
+                 * The identifier changes each time the transform of the axis changes
+                 *
+                 * @return identifier of the transform, zero if the transform is not available
+                 */
+                size_t                      transform_id();
                 bool                        parallel(float x, float y, float &a, float &b, float &c);
                 void                        ortogonal_shift(float x, float y, float shift, float &nx, float &ny);
                 bool                        angle(float x, float y, float angle, float &a, float &b, float &c);
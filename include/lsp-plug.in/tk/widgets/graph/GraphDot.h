@@ -153,6 +153,8 @@ namespace lsp
                 LSP_TK_PROPERTY(Color,              hover_gap_color,    &sHoverGapColor)
 
             public:
+                virtual graph_layer_t       layer() const;
+
                 virtual void                render(ws::ISurface *s, const ws::rectangle_t *area, bool force);
 
                 virtual bool                inside(ssize_t x, ssize_t y);
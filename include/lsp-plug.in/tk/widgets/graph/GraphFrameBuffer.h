@@ -57,6 +57,11 @@ namespace lsp
             protected:
                 typedef void (GraphFrameBuffer::*calc_color_t)(float *rgba, const float *value, size_t n);
 
+                enum palette_t
+                {
+                    PALETTE_SIZE    = 4096                      // Number of entries in the color palette
+                };
+
             protected:
                 prop::GraphFrameData        sData;              // Framebuffer data
                 prop::Float                 sTransparency;      // Framebuffer transparency
@@ -71,11 +76,18 @@ namespace lsp
                 bool                        bClear;             // Perform full cleanup of image
                 size_t                      nRows;              // Cached number of rows
                 size_t                      nCols;              // Cached number of columns
+                size_t                      nHead;              // Surface row that holds the most recent frame row
                 calc_color_t                pCalcColor;         // Function to compute
 
-                float                      *fRGBA;              // RGBA buffer
-                uint8_t                    *pfRGBA;             // Unaligned RGBA buffer
-                size_t                      nCapacity;          // RGBA buffer capacity
+                float                      *fRGBA;              // Buffer for palette indexes
+                uint8_t                    *pfRGBA;             // Unaligned buffer for palette indexes
+                size_t                      nCapacity;          // Index buffer capacity
+
+                uint32_t                   *vPalette;           // Palette of pre-computed BGRA32 colors
+                uint8_t                    *pPalette;           // Unaligned palette buffer
+                float                       fPalMin;            // Value that corresponds to the first palette entry
+                float                       fPalMax;            // Value that corresponds to the last palette entry
+                bool                        bPalette;           // Palette is valid
 
             protected:
                 void                        calc_rainbow_color(float *rgba, const float *value, size_t n);
@@ -85,8 +97,14 @@ namespace lsp
                 void                        calc_lightness2(float *rgba, const float *value, size_t n);
 
                 void                        destroy_data();
+                bool                        sync_palette();
+                void                        map_colors(uint32_t *dst, const float *v, size_t n);
+                void                        draw_part(ws::ISurface *s, ws::ISurface *pp,
+                                                float x, float y, float sx, float sy, float ra,
+                                                const float *rv, const float *cv, ssize_t first, ssize_t last);
 
                 virtual void                property_changed(Property *prop);
+                virtual void                surface_created(ws::ISurface *s);
 
             public:
                 explicit GraphFrameBuffer(Display *dpy);
@@ -107,6 +125,8 @@ namespace lsp
                 LSP_TK_PROPERTY(GraphFrameFunction,     function,           &sFunction)
 
             public:
+                virtual graph_layer_t       layer() const;
+
                 virtual void                render(ws::ISurface *s, const ws::rectangle_t *area, bool force);
 
                 virtual void                draw(ws::ISurface *s);
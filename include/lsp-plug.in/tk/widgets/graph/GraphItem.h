@@ -53,6 +53,7 @@ namespace lsp
 
             protected:
                 virtual void            property_changed(Property *prop);
+                virtual void            hide_widget();
 
             public:
                 explicit GraphItem(Display *dpy);
@@ -74,6 +75,14 @@ namespace lsp
 
                 virtual void        query_draw(size_t flags = REDRAW_SURFACE);
 
+                /**
+                 * Get the layer of the graph the item is rendered on. Items are always drawn
+                 * in the order of the list, the graph caches only the leading run of items
+                 * that belong to the static layer
+                 * @return layer of the graph item
+                 */
+                virtual graph_layer_t   layer() const;
+
                 /**
                  * Check whether mouse pointer is inside of the graph item
                  * @param x horizontal position of mouse pointer
@@ -42,6 +42,7 @@ namespace lsp
                 prop::Color                 sColor;         // Mesh color
                 prop::Color                 sFillColor;     // Fill color
                 prop::GraphMeshData         sData;          // Graph mesh data
+                prop::Boolean               sSimplify;      // Simplify mesh to the resolution of the canvas
             LSP_TK_STYLE_DEF_END
         }
 
@@ -62,9 +63,18 @@ namespace lsp
                 prop::Color                 sColor;         // Mesh color
                 prop::Color                 sFillColor;     // Fill color
                 prop::GraphMeshData         sData;          // Graph mesh data
+                prop::Boolean               sSimplify;      // Simplify mesh to the resolution of the canvas
 
-                float                      *vBuffer;        // Temporary buffer
-                size_t                      nCapacity;      // Capacity of the temporary buffer
+                float                      *vBuffer;        // Buffer for transformed coordinates
+                size_t                      nCapacity;      // Capacity of the buffer
+                size_t                      nStride;        // Stride between coordinate arrays in the buffer
+                GraphAxis                  *pXAxis;         // Horizontal axis of the cached transform
+                GraphAxis                  *pYAxis;         // Vertical axis of the cached transform
+                size_t                      nXAxisId;       // Transform identifier of the horizontal axis
+                size_t                      nYAxisId;       // Transform identifier of the vertical axis
+                float                       fOriginX;       // Horizontal coordinate of the origin
+                float                       fOriginY;       // Vertical coordinate of the origin
+                bool                        bCached;        // Cached transform is valid
 
             protected:
                 virtual void                property_changed(Property *prop);
@@ -87,8 +97,11 @@ namespace lsp
                 LSP_TK_PROPERTY(Color,              color,                      &sColor)
                 LSP_TK_PROPERTY(Color,              fill_color,                 &sFillColor)
                 LSP_TK_PROPERTY(GraphMeshData,      data,                       &sData)
+                LSP_TK_PROPERTY(Boolean,            simplify,                   &sSimplify)
 
             public:
+                virtual graph_layer_t       layer() const;
+
                 virtual void                render(ws::ISurface *s, const ws::rectangle_t *area, bool force);
         };
     }
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_TK_WIDGETS_GRAPH_GRAPHMESHSET_H_
+#define LSP_PLUG_IN_TK_WIDGETS_GRAPH_GRAPHMESHSET_H_
+
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+namespace lsp
+{
+    namespace tk
+    {
+        class GraphMeshSet;
+
+        // Style definition
+        namespace style
+        {
+            LSP_TK_STYLE_DEF_BEGIN(GraphMeshSet, GraphItem)
+                prop::Integer               sOrigin;        // Index of origin
+                prop::Integer               sXAxis;         // Index of X axis
+                prop::Integer               sYAxis;         // Index of Y axis
+                prop::Integer               sWidth;         // Width of the mesh lines
+                prop::Boolean               sFill;          // Fill polys
+                prop::Boolean               sSimplify;      // Simplify meshes to the resolution of the canvas
+            LSP_TK_STYLE_DEF_END
+
+            LSP_TK_STYLE_DEF_BEGIN(GraphMeshSeries, Style)
+                prop::Boolean               sVisibility;    // Visibility of the series
+                prop::Color                 sColor;         // Mesh color
+                prop::Color                 sFillColor;     // Fill color
+            LSP_TK_STYLE_DEF_END
+        }
+
+        /**
+         * Single series of the mesh set
+         */
+        class GraphMeshSeries
+        {
+            private:
+                GraphMeshSeries & operator = (const GraphMeshSeries &);
+                GraphMeshSeries(const GraphMeshSeries &);
+                friend class GraphMeshSet;
+
+            protected:
+                Style                       sStyle;         // Style of the series
+                prop::Boolean               sVisibility;    // Visibility of the series
+                prop::Color                 sColor;         // Mesh color
+                prop::Color                 sFillColor;     // Fill color
+                prop::GraphMeshData         sData;          // Mesh data
+
+            protected:
+                explicit GraphMeshSeries(Schema *schema, prop::Listener *listener);
+
+                status_t                    init();
+                bool                        is(Property *prop) const;
+                bool                        drawable() const;
+
+            public:
+                LSP_TK_PROPERTY(Boolean,            visibility,                 &sVisibility)
+                LSP_TK_PROPERTY(Color,              color,                      &sColor)
+                LSP_TK_PROPERTY(Color,              fill_color,                 &sFillColor)
+                LSP_TK_PROPERTY(GraphMeshData,      data,                       &sData)
+        };
+
+        /**
+         * Set of meshes that share the same axes and line settings and are rendered in one pass
+         */
+        class GraphMeshSet: public GraphItem
+        {
+            public:
+                static const w_class_t    metadata;
+
+            private:
+                GraphMeshSet & operator = (const GraphMeshSet &);
+
+            protected:
+                prop::Integer               sOrigin;        // Index of origin
+                prop::Integer               sXAxis;         // Index of X axis
+                prop::Integer               sYAxis;         // Index of Y axis
+                prop::Integer               sWidth;         // Width of the mesh lines
+                prop::Boolean               sFill;          // Fill polys
+                prop::Boolean               sSimplify;      // Simplify meshes to the resolution of the canvas
+
+                lltl::parray<GraphMeshSeries>   vSeries;    // List of series
+                lltl::darray<float *>       vXPtr;          // Batch of horizontal coordinate buffers
+                lltl::darray<float *>       vYPtr;          // Batch of vertical coordinate buffers
+                lltl::darray<const float *> vXData;         // Batch of X data
+                lltl::darray<const float *> vYData;         // Batch of Y data
+                ScratchBuffer               sBuffer;        // Buffer for transformed coordinates
+
+            protected:
+                virtual void                property_changed(Property *prop);
+
+                void                        do_destroy();
+                void                        clear_batch();
+                bool                        apply_batch(GraphAxis *xaxis, GraphAxis *yaxis, size_t count);
+
+            public:
+                explicit GraphMeshSet(Display *dpy);
+                virtual ~GraphMeshSet();
+
+                virtual status_t            init();
+                virtual void                destroy();
+
+            public:
+                LSP_TK_PROPERTY(Integer,            origin,                     &sOrigin)
+                LSP_TK_PROPERTY(Integer,            haxis,                      &sXAxis)
+                LSP_TK_PROPERTY(Integer,            vaxis,                      &sYAxis)
+                LSP_TK_PROPERTY(Integer,            width,                      &sWidth)
+                LSP_TK_PROPERTY(Boolean,            fill,                       &sFill)
+                LSP_TK_PROPERTY(Boolean,            simplify,                   &sSimplify)
+
+            public:
+                /**
+                 * Get number of series
+                 * @return number of series
+                 */
+                inline size_t               num_series() const          { return vSeries.size();        }
+
+                /**
+                 * Get series by index
+                 * @param index index of the series
+                 * @return series or NULL
+                 */
+                inline GraphMeshSeries     *series(size_t index)        { return vSeries.get(index);    }
+
+                /**
+                 * Add new series to the end of the list
+                 * @return pointer to the added series or NULL if no memory
+                 */
+                GraphMeshSeries            *add_series();
+
+                /**
+                 * Remove series
+                 * @param index index of the series
+                 * @return status of operation
+                 */
+                status_t                    remove_series(size_t index);
+
+                /**
+                 * Remove all series
+                 */
+                void                        clear_series();
+
+            public:
+                virtual graph_layer_t       layer() const;
+
+                virtual void                render(ws::ISurface *s, const ws::rectangle_t *area, bool force);
+        };
+    }
+}
+
+
+#endif /* LSP_PLUG_IN_TK_WIDGETS_GRAPH_GRAPHMESHSET_H_ */
@@ -51,6 +51,23 @@ namespace lsp
                 static const w_class_t    metadata;
 
             protected:
+                enum atlas_t
+                {
+                    ATLAS_COLUMNS   = 16,           // Number of glyphs in the row of the atlas
+                    ATLAS_STATES    = 1 << 11       // Number of segment states, one bit per segment
+                };
+
+            protected:
+                ws::ISurface       *pAtlas;         // Atlas of pre-rendered glyphs
+                int16_t             vSlots[ATLAS_STATES];   // Slot of the glyph in the atlas for each segment state, negative if not rendered
+                size_t              nGlyphs;        // Number of glyphs stored in the atlas
+                size_t              nAtlasRows;     // Number of rows in the atlas
+                ssize_t             nCellWidth;     // Width of the glyph cell
+                ssize_t             nCellHeight;    // Height of the glyph cell
+                float               fAtlasScaling;  // Scaling of glyphs in the atlas
+                uint32_t            nAtlasOn;       // Color of lit segments in the atlas
+                uint32_t            nAtlasOff;      // Color of unlit segments in the atlas
+
                 prop::Color         sColor;         // Color of the indicator
                 prop::Color         sTextColor;     // Color of the text
                 prop::Integer       sRows;          // Number of rows
@@ -63,16 +80,21 @@ namespace lsp
             protected:
                 void                draw_digit(ws::ISurface *s, float x, float y, size_t state, const lsp::Color &on, const lsp::Color &off);
                 uint8_t             get_char(const LSPString *str, size_t index);
+                ssize_t             get_glyph(ws::ISurface *s, size_t state, const lsp::Color &on, const lsp::Color &off);
+                void                draw_glyph(ws::ISurface *s, size_t col, size_t row, size_t state, const lsp::Color &on, const lsp::Color &off);
+                void                drop_glyphs();
 
             protected:
                 virtual void        size_request(ws::size_limit_t *r);
                 virtual void        property_changed(Property *prop);
+                virtual void        hide_widget();
 
             public:
                 explicit            Indicator(Display *dpy);
                 virtual             ~Indicator();
 
                 virtual status_t    init();
+                virtual void        destroy();
 
             public:
                 LSP_TK_PROPERTY(Color,              color,              &sColor)
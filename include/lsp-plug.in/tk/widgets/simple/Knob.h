@@ -60,6 +60,27 @@ namespace lsp
                     S_CLICK
                 };
 
+                enum face_layer_t
+                {
+                    FACE_BASE,          // Background and the scale
+                    FACE_OVERLAY        // Ticks and hole
+                };
+
+                typedef struct face_key_t
+                {
+                    uint32_t            nLayer;         // Layer of the face
+                    uint32_t            nWidth;         // Width of the face
+                    uint32_t            nHeight;        // Height of the face
+                    float               fScaling;       // Scaling factor
+                    float               fBright;        // Brightness
+                    float               fScale;         // Size of the scale
+                    uint32_t            nScaleColor;    // Scale color
+                    uint32_t            nHoleColor;     // Hole color
+                    uint32_t            nBgColor;       // Background color
+                    uint32_t            bCycling;       // Cycling mode
+                    float               fBalance;       // Balance, rotates the ticks in cycling mode
+                } face_key_t;
+
             protected:
                 ssize_t             nLastY;
                 size_t              nState;
@@ -81,6 +102,8 @@ namespace lsp
                 size_t                          check_mouse_over(ssize_t x, ssize_t y);
                 void                            update_value(float delta);
                 void                            on_click(ssize_t x, ssize_t y);
+                void                            draw_face(ws::ISurface *s, size_t layer);
+                void                            draw_face_cached(ws::ISurface *s, size_t layer);
 
             protected:
                 static status_t                 slot_on_change(Widget *sender, void *ptr, void *data);
@@ -39,10 +39,17 @@ namespace lsp
         
         class ListBoxItem: public Widget
         {
+            private:
+                friend class ListBox;
+
             public:
                 static const w_class_t    metadata;
 
             protected:
+                ssize_t                     nTextWidth;     // Cached width of the text
+                ssize_t                     nTextHeight;    // Cached height of the text
+                size_t                      nTextSerial;    // Serial number of the cached text size, zero if not valid
+
                 prop::String                sText;
                 prop::Color                 sBgSelectedColor;
                 prop::Color                 sTextColor;
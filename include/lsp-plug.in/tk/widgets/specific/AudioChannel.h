@@ -83,6 +83,8 @@ namespace lsp
                 prop::Color             sFadeOutBorderColor;// Fade-out color
                 prop::SizeConstraints   sConstraints;       // Size constraints
 
+                ScratchBuffer           sBuffer;            // Persistent buffer for drawing the waveform
+
             protected:
                 virtual void            size_request(ws::size_limit_t *r);
                 virtual void            property_changed(Property *prop);
@@ -96,6 +98,14 @@ namespace lsp
 
                 virtual status_t        init();
 
+            public:
+                /**
+                 * Get number of memory allocations performed by the drawing routines,
+                 * should not change between redraws of the widget with the same size
+                 * @return number of memory allocations
+                 */
+                inline size_t           draw_allocations() const        { return sBuffer.allocations(); }
+
             public:
                 LSP_TK_PROPERTY(FloatArray,             samples,                &vSamples);
                 LSP_TK_PROPERTY(Integer,                fade_in,                &sFadeIn);
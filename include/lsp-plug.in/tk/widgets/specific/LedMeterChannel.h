@@ -99,8 +99,24 @@ namespace lsp
                 ws::rectangle_t         sAMeter;            // Meter drawing area
                 ws::rectangle_t         sAText;             // Text drawing area
 
+                ws::ISurface           *pLit;               // Pre-rendered strip of lit segments
+                ws::ISurface           *pUnlit;             // Pre-rendered strip of unlit segments
+                ssize_t                 nStripWidth;        // Width of strips
+                ssize_t                 nStripHeight;       // Height of strips
+                ssize_t                 nStripAngle;        // Angle of strips
+                float                   fStripScaling;      // Scaling of strips
+                float                   fStripBright;       // Brightness of strips
+                float                   fStripMin;          // Minimum value of strips
+                float                   fStripMax;          // Maximum value of strips
+                bool                    bStrips;            // Strips are valid
+
             protected:
                 void                        draw_meter(ws::ISurface *s, ssize_t angle, float scaling, float bright);
+                void                        draw_segment(ws::ISurface *s, const lsp::Color *c, bool lit, float bright,
+                                                float x, float y, float w, float h, float scaling);
+                void                        draw_strip(ws::ISurface *s, bool lit, ssize_t segments, ssize_t angle, float scaling, float bright);
+                bool                        sync_strips(ws::ISurface *s, ssize_t segments, ssize_t angle, float scaling, float bright);
+                void                        drop_strips();
                 void                        draw_label(ws::ISurface *s, const Font *f, float scaling, float bright);
                 const lsp::Color           *get_color(float value, const ColorRanges *ranges, const Color *dfl);
 
@@ -109,11 +125,13 @@ namespace lsp
                 virtual ~LedMeterChannel();
 
                 virtual status_t            init();
+                virtual void                destroy();
 
             protected:
                 virtual void                property_changed(Property *prop);
                 virtual void                size_request(ws::size_limit_t *r);
                 virtual void                realize(const ws::rectangle_t *r);
+                virtual void                hide_widget();
 
             public:
                 LSP_TK_PROPERTY(RangeFloat,         value,              &sValue)
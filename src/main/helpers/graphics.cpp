@@ -290,6 +290,57 @@ namespace lsp
         {
             return (x >= lc) && (x <= rc) && (y >= bc) && (y <= tc);
         }
+
+        size_t decimate2d(float *x, float *y, size_t n)
+        {
+            size_t idx[4];
+            size_t k = 0;
+
+            // Only polylines with monotonic horizontal coordinates can be decimated
+            if (n < 2)
+                return n;
+            bool dec        = x[n-1] < x[0];
+            for (size_t i=1; i<n; ++i)
+            {
+                if ((dec) ? (x[i] > x[i-1]) : (x[i] < x[i-1]))
+                    return n;
+            }
+
+            for (size_t i=0; i<n; )
+            {
+                // Find the run of points within the same pixel column
+                float col       = floorf(x[i]);
+                size_t first    = i, imin = i, imax = i;
+                for (++i; (i < n) && (floorf(x[i]) == col); ++i)
+                {
+                    if (y[i] < y[imin])
+                        imin            = i;
+                    if (y[i] > y[imax])
+                        imax            = i;
+                }
+
+                // Form the list of points to keep in the original order
+                size_t lo       = lsp_min(imin, imax);
+                size_t hi       = lsp_max(imin, imax);
+                size_t count    = 0;
+                idx[count++]    = first;
+                if (lo > idx[count-1])
+                    idx[count++]    = lo;
+                if (hi > idx[count-1])
+                    idx[count++]    = hi;
+                if ((i - 1) > idx[count-1])
+                    idx[count++]    = i - 1;
+
+                // Move points, indexes are always ascending, so the data is not lost
+                for (size_t j=0; j<count; ++j, ++k)
+                {
+                    x[k]            = x[idx[j]];
+                    y[k]            = y[idx[j]];
+                }
+            }
+
+            return k;
+        }
     }
 }
 
@@ -29,10 +29,191 @@ namespace lsp
         FloatArray::FloatArray(prop::Listener *listener):
             Property(listener)
         {
+            nDirtyFirst     = 0;
+            nDirtyLast      = 0;
+            bPeaks          = false;
+            bDirty          = false;
         }
 
         FloatArray::~FloatArray()
         {
+            for (size_t i=0; i<PEAK_LEVELS; ++i)
+                vPeaks[i].flush();
+        }
+
+        void FloatArray::invalidate(size_t first, size_t last)
+        {
+            if (!bPeaks)
+                return;
+
+            if (bDirty)
+            {
+                nDirtyFirst     = lsp_min(nDirtyFirst, first);
+                nDirtyLast      = lsp_max(nDirtyLast, last);
+            }
+            else
+            {
+                nDirtyFirst     = first;
+                nDirtyLast      = last;
+                bDirty          = true;
+            }
+        }
+
+        void FloatArray::drop_peaks()
+        {
+            for (size_t i=0; i<PEAK_LEVELS; ++i)
+                vPeaks[i].clear();
+            bDirty          = false;
+        }
+
+        bool FloatArray::update_peaks()
+        {
+            // Build the whole pyramid on the first request
+            if (!bPeaks)
+            {
+                bPeaks          = true;
+                bDirty          = true;
+                nDirtyFirst     = 0;
+                nDirtyLast      = vItems.size();
+            }
+            if (!bDirty)
+                return true;
+
+            size_t n        = vItems.size();
+            size_t first    = nDirtyFirst;
+            size_t last     = nDirtyLast;
+            const float *v  = vItems.array();
+            const peak_t *p = NULL;
+
+            for (size_t l=0; l<PEAK_LEVELS; ++l)
+            {
+                lltl::darray<peak_t> *dst = &vPeaks[l];
+
+                // Stop if there is nothing to decimate
+                if (n <= 1)
+                {
+                    dst->clear();
+                    continue;
+                }
+
+                // Resize the level
+                size_t count    = (n + PEAK_BLOCK - 1) >> PEAK_SHIFT;
+                if (dst->size() > count)
+                    dst->truncate(count);
+                else if (dst->size() < count)
+                {
+                    if (dst->append_n(count - dst->size()) == NULL)
+                    {
+                        drop_peaks();
+                        bPeaks          = false;
+                        return false;
+                    }
+                }
+
+                // Update blocks that cover the dirty range, the last block
+                // always has to be updated if the size of the level has changed
+                last            = lsp_min(last, n);
+                if (first >= last)
+                    first           = n - 1;
+                size_t bfirst   = first >> PEAK_SHIFT;
+                size_t blast    = (last + PEAK_BLOCK - 1) >> PEAK_SHIFT;
+                peak_t *dp      = dst->array();
+
+                for (size_t b=bfirst; b<blast; ++b)
+                {
+                    size_t i        = b << PEAK_SHIFT;
+                    size_t end      = lsp_min(i + PEAK_BLOCK, n);
+                    peak_t *xp      = &dp[b];
+
+                    if (p == NULL)
+                    {
+                        xp->fMin        = v[i];
+                        xp->fMax        = v[i];
+                        for (++i; i<end; ++i)
+                        {
+                            xp->fMin        = lsp_min(xp->fMin, v[i]);
+                            xp->fMax        = lsp_max(xp->fMax, v[i]);
+                        }
+                    }
+                    else
+                    {
+                        *xp             = p[i];
+                        for (++i; i<end; ++i)
+                        {
+                            xp->fMin        = lsp_min(xp->fMin, p[i].fMin);
+                            xp->fMax        = lsp_max(xp->fMax, p[i].fMax);
+                        }
+                    }
+                }
+
+                // Go to the next level
+                p               = dp;
+                n               = count;
+                first           = bfirst;
+                last            = blast;
+            }
+
+            bDirty          = false;
+            return true;
+        }
+
+        void FloatArray::scan_range(float *min, float *max, ssize_t level, size_t first, size_t last) const
+        {
+            if (level < 0)
+            {
+                const float *v  = vItems.array();
+                for (size_t i=first; i<last; ++i)
+                {
+                    *min            = lsp_min(*min, v[i]);
+                    *max            = lsp_max(*max, v[i]);
+                }
+            }
+            else
+            {
+                const peak_t *p = vPeaks[level].array();
+                for (size_t i=first; i<last; ++i)
+                {
+                    *min            = lsp_min(*min, p[i].fMin);
+                    *max            = lsp_max(*max, p[i].fMax);
+                }
+            }
+        }
+
+        bool FloatArray::peaks(float *min, float *max, size_t first, size_t count)
+        {
+            size_t n        = vItems.size();
+            if ((first >= n) || (count <= 0))
+                return false;
+            if (!update_peaks())
+                return false;
+
+            size_t last     = first + lsp_min(count, n - first);
+            float vmin      = vItems.uget(first)[0];
+            float vmax      = vmin;
+            ssize_t level   = -1;
+
+            // Go up the pyramid while the range contains at least one complete block
+            while ((level + 1) < PEAK_LEVELS)
+            {
+                size_t bfirst   = (first + PEAK_BLOCK - 1) >> PEAK_SHIFT;
+                size_t blast    = last >> PEAK_SHIFT;
+                if ((bfirst >= blast) || (vPeaks[level + 1].size() < blast))
+                    break;
+
+                // Scan the incomplete blocks at the edges of the range
+                scan_range(&vmin, &vmax, level, first, bfirst << PEAK_SHIFT);
+                scan_range(&vmin, &vmax, level, blast << PEAK_SHIFT, last);
+
+                first           = bfirst;
+                last            = blast;
+                ++level;
+            }
+
+            scan_range(&vmin, &vmax, level, first, last);
+
+            *min            = vmin;
+            *max            = vmax;
+            return true;
         }
 
         float FloatArray::get(size_t index) const
@@ -47,6 +228,7 @@ namespace lsp
                 return;
 
             vItems.clear();
+            drop_peaks();
             sync();
         }
 
@@ -59,6 +241,7 @@ namespace lsp
             if (xsize > size)
             {
                 vItems.truncate(size);
+                invalidate(size, size);
                 sync();
                 return STATUS_OK;
             }
@@ -69,6 +252,7 @@ namespace lsp
                 return STATUS_NO_MEM;
 
             dsp::fill_zero(v, size);
+            invalidate(xsize, vItems.size());
             sync();
             return STATUS_OK;
         }
@@ -80,6 +264,7 @@ namespace lsp
                 return STATUS_NO_MEM;
 
             dsp::copy(dst, v, count);
+            invalidate(0, vItems.size());
             sync();
             return STATUS_OK;
         }
@@ -91,6 +276,7 @@ namespace lsp
                 return STATUS_NO_MEM;
 
             dsp::copy(dst, v, count);
+            invalidate(vItems.size() - count, vItems.size());
             sync();
             return STATUS_OK;
         }
@@ -102,6 +288,7 @@ namespace lsp
                 return STATUS_NO_MEM;
 
             dsp::copy(dst, v, count);
+            invalidate(idx, vItems.size());
             sync();
             return STATUS_OK;
         }
@@ -111,6 +298,7 @@ namespace lsp
             if (!vItems.remove_n(idx, count))
                 return STATUS_INVALID_VALUE;
 
+            invalidate(idx, vItems.size());
             sync();
             return STATUS_OK;
         }
@@ -120,6 +308,7 @@ namespace lsp
             if (!vItems.set_n(count, v))
                 return STATUS_NO_MEM;
 
+            invalidate(0, vItems.size());
             sync();
             return STATUS_OK;
         }
@@ -133,6 +322,7 @@ namespace lsp
                 return STATUS_OK;
 
             *xv     = v;
+            invalidate(idx, idx + 1);
             sync();
             return STATUS_OK;
         }
@@ -142,6 +332,7 @@ namespace lsp
             if (!vItems.set_n(idx, count, v))
                 return STATUS_INVALID_VALUE;
 
+            invalidate(idx, idx + count);
             sync();
             return STATUS_OK;
         }
@@ -152,6 +343,8 @@ namespace lsp
                 return;
 
             vItems.swap(src->vItems);
+            invalidate(0, vItems.size());
+            src->invalidate(0, src->vItems.size());
             sync();
             src->sync();
         }
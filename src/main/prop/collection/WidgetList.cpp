@@ -20,6 +20,7 @@
  */
 
 #include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/lltl/phashset.h>
 
 namespace lsp
 {
@@ -276,6 +277,82 @@ namespace lsp
             return STATUS_OK;
         }
 
+        status_t GenericWidgetList::assign(const lltl::parray<Widget> *list, bool manage)
+        {
+            lltl::phashset<Widget> next, prev, managed;
+            lltl::darray<item_t> items;
+
+            // Validate the new list
+            for (size_t i=0, n=list->size(); i<n; ++i)
+            {
+                Widget *w = list->uget(i);
+                if (w == NULL)
+                    return STATUS_BAD_ARGUMENTS;
+                if (!w->instance_of(pMeta))
+                    return STATUS_BAD_TYPE;
+                if (next.contains(w))
+                    return STATUS_ALREADY_EXISTS;
+                if (!next.put(w))
+                    return STATUS_NO_MEM;
+            }
+
+            // Index the current list
+            for (size_t i=0, n=sList.size(); i<n; ++i)
+            {
+                item_t *xw  = sList.uget(i);
+                if (!prev.put(xw->pWidget))
+                    return STATUS_NO_MEM;
+                if ((xw->bManage) && (!managed.put(xw->pWidget)))
+                    return STATUS_NO_MEM;
+            }
+
+            // Build the new list
+            for (size_t i=0, n=list->size(); i<n; ++i)
+            {
+                Widget *w   = list->uget(i);
+                item_t *xw  = items.add();
+                if (xw == NULL)
+                    return STATUS_NO_MEM;
+
+                xw->pWidget = w;
+                xw->bManage = (prev.contains(w)) ? managed.contains(w) : manage;
+            }
+
+            items.swap(&sList);
+
+            // Notify listeners for removal and addition
+            if (pCListener != NULL)
+            {
+                for (size_t i=0, n=items.size(); i<n; ++i)
+                {
+                    item_t *xw  = items.uget(i);
+                    if (!next.contains(xw->pWidget))
+                        pCListener->remove(this, xw->pWidget);
+                }
+                for (size_t i=0, n=sList.size(); i<n; ++i)
+                {
+                    item_t *xw  = sList.uget(i);
+                    if (!prev.contains(xw->pWidget))
+                        pCListener->add(this, xw->pWidget);
+                }
+            }
+            if (pListener != NULL)
+                pListener->notify(this);
+
+            // Manage removed items
+            for (size_t i=0, n=items.size(); i<n; ++i)
+            {
+                item_t *xw = items.uget(i);
+                if ((xw->bManage) && (!next.contains(xw->pWidget)))
+                {
+                    xw->pWidget->destroy();
+                    delete xw->pWidget;
+                }
+            }
+
+            return STATUS_OK;
+        }
+
         status_t GenericWidgetList::swap(GenericWidgetList *dst)
         {
             if (pMeta != dst->pMeta)
@@ -282,6 +282,20 @@ namespace lsp
                 sync();
         }
 
+        TextCache *Font::text_cache() const
+        {
+            Schema *schema  = (pStyle != NULL) ? pStyle->schema() : NULL;
+            return (schema != NULL) ? schema->text_cache() : NULL;
+        }
+
+        bool Font::measure(ws::ISurface *s, const ws::Font *f, ws::text_parameters_t *tp, const LSPString *text, ssize_t first, ssize_t last) const
+        {
+            TextCache *cache = text_cache();
+            return (cache != NULL) ?
+                    cache->measure(s, f, tp, text, first, last) :
+                    s->get_text_parameters(*f, tp, text, first, last);
+        }
+
         void Font::set(const ws::Font *f)
         {
             set(f->get_name(), f->get_size(), f->flags());
@@ -371,11 +385,7 @@ namespace lsp
                 }
 
                 // Get text parameters
-                const char *str = text->get_utf8(prev, tail);
-                if (str == NULL)
-                    return false;
-
-                if (!s->get_text_parameters(f, &xp, str))
+                if (!measure(s, &f, &xp, text, prev, tail))
                     return false;
 
                 if (w < xp.Width)
@@ -426,7 +436,7 @@ namespace lsp
 
         bool Font::get_text_parameters(ws::ISurface *s, ws::text_parameters_t *tp, float scaling, const LSPString *text, ssize_t first) const
         {
-            return (text != NULL) ? get_text_parameters(s, tp, scaling, text, 0, text->length()) : false;
+            return (text != NULL) ? get_text_parameters(s, tp, scaling, text, first, text->length()) : false;
         }
 
         bool Font::get_text_parameters(ws::ISurface *s, ws::text_parameters_t *tp, float scaling, const LSPString *text, ssize_t first, ssize_t last) const
@@ -435,7 +445,7 @@ namespace lsp
                 return false;
 
             ws::Font f(sValue.get_name(), sValue.get_size() * lsp_max(0.0f, scaling), sValue.flags());
-            return s->get_text_parameters(f, tp, text, first, last);
+            return measure(s, &f, tp, text, first, last);
         }
 
         bool Font::get_text_parameters(ws::ISurface *s, ws::text_parameters_t *tp, float scaling, const char *text) const
@@ -230,6 +230,27 @@ namespace lsp
             return (r->nWidth <= 0) || (r->nHeight <= 0);
         }
 
+        bool Size::contains(const ws::rectangle_t *outer, const ws::rectangle_t *inner)
+        {
+            return (inner->nLeft >= outer->nLeft) &&
+                   (inner->nTop >= outer->nTop) &&
+                   ((inner->nLeft + inner->nWidth) <= (outer->nLeft + outer->nWidth)) &&
+                   ((inner->nTop + inner->nHeight) <= (outer->nTop + outer->nHeight));
+        }
+
+        void Size::enclose(ws::rectangle_t *dst, const ws::rectangle_t *a, const ws::rectangle_t *b)
+        {
+            ssize_t l   = lsp_min(a->nLeft, b->nLeft);
+            ssize_t t   = lsp_min(a->nTop, b->nTop);
+            ssize_t r   = lsp_max(a->nLeft + a->nWidth, b->nLeft + b->nWidth);
+            ssize_t bt  = lsp_max(a->nTop + a->nHeight, b->nTop + b->nHeight);
+
+            dst->nLeft      = l;
+            dst->nTop       = t;
+            dst->nWidth     = r - l;
+            dst->nHeight    = bt - t;
+        }
+
         namespace prop
         {
             void Size::commit_value(size_t width, size_t height, float scale)
@@ -49,6 +49,8 @@ namespace lsp
             nSize       = 0;
             nStride     = 0;
             pPtr        = NULL;
+
+            advance();
         }
 
         GraphMeshData::~GraphMeshData()
@@ -140,8 +142,11 @@ namespace lsp
                 dsp::fill_zero(&vData[nStride + size], n);
             }
 
-            // Update size
+            // Update size, all data should be considered changed
             nSize       = size;
+            mark_changed(C_X, 0, size);
+            mark_changed(C_Y, 0, size);
+
             return true;
         }
 
@@ -159,9 +164,60 @@ namespace lsp
             return res;
         }
 
-        void GraphMeshData::copy_data(float *dst, const float *src, size_t n)
+        void GraphMeshData::mark_changed(size_t coord, size_t first, size_t last)
         {
-            dsp::copy(dst, src, n);
+            if (first >= last)
+                return;
+
+            range_t *r      = &vChanges[coord];
+            if (r->nFirst < r->nLast)
+            {
+                r->nFirst       = lsp_min(r->nFirst, first);
+                r->nLast        = lsp_max(r->nLast, last);
+            }
+            else
+            {
+                r->nFirst       = first;
+                r->nLast        = last;
+            }
+        }
+
+        bool GraphMeshData::get_changes(size_t coord, size_t *first, size_t *count) const
+        {
+            const range_t *r    = &vChanges[coord];
+            size_t last         = lsp_min(r->nLast, nSize);
+            if (r->nFirst >= last)
+                return false;
+
+            *first              = r->nFirst;
+            *count              = last - r->nFirst;
+            return true;
+        }
+
+        void GraphMeshData::advance()
+        {
+            for (size_t i=0; i<C_COUNT; ++i)
+            {
+                vChanges[i].nFirst  = 0;
+                vChanges[i].nLast   = 0;
+            }
+        }
+
+        void GraphMeshData::copy_data(size_t coord, const float *src, size_t n)
+        {
+            // Find the range of elements that really change
+            float *dst      = &vData[coord * nStride];
+            size_t first    = 0, last = n;
+            while ((first < last) && (dst[first] == src[first]))
+                ++first;
+            while ((last > first) && (dst[last-1] == src[last-1]))
+                --last;
+
+            if (first < last)
+            {
+                dsp::copy(&dst[first], &src[first], last - first);
+                mark_changed(coord, first, last);
+            }
             if (n < nStride)
                 dsp::fill_zero(&dst[n], nStride - n);
 
@@ -176,7 +232,7 @@ namespace lsp
                 return false;
 
             if (vData != NULL)
-                copy_data(&vData[0], v, size);
+                copy_data(C_X, v, size);
             sync();
 
             return true;
@@ -188,7 +244,7 @@ namespace lsp
                 return false;
 
             if (vData != NULL)
-                copy_data(&vData[nStride], v, size);
+                copy_data(C_Y, v, size);
             sync();
 
             return true;
@@ -201,8 +257,8 @@ namespace lsp
 
             if (vData != NULL)
             {
-                copy_data(&vData[0], x, size);
-                copy_data(&vData[nStride], y, size);
+                copy_data(C_X, x, size);
+                copy_data(C_Y, y, size);
             }
             sync();
 
@@ -140,12 +140,76 @@ namespace lsp
             if (sheet == NULL)
                 return STATUS_BAD_ARGUMENTS;
 
-            // Apply settings in configuration mode
-            nFlags |= S_CONFIGURING;
+            // Apply settings in configuration mode as a single transaction
+            nFlags |= S_CONFIGURING | S_TRANSACTION;
             status_t res = apply_internal(sheet);
+            status_t xres = complete_transaction();
             nFlags &= ~S_CONFIGURING;
 
-            return res;
+            return (res != STATUS_OK) ? res : xres;
+        }
+
+        status_t Schema::order_styles(lltl::parray<Style> *list, Style *s)
+        {
+            if (s->nFlags & Style::S_VISITED)
+                return STATUS_OK;
+            s->nFlags  |= Style::S_VISITED;
+
+            // Children are added to the list before their parents
+            for (size_t i=0, n=s->vChildren.size(); i<n; ++i)
+            {
+                Style *child = s->vChildren.uget(i);
+                if (child == NULL)
+                    continue;
+
+                status_t res = order_styles(list, child);
+                if (res != STATUS_OK)
+                    return res;
+            }
+
+            return (list->add(s)) ? STATUS_OK : STATUS_NO_MEM;
+        }
+
+        status_t Schema::complete_transaction()
+        {
+            lltl::parray<Style> list, vs;
+
+            // Collect all styles reachable from the schema styles
+            status_t res = (vStyles.values(&vs)) ? STATUS_OK : STATUS_NO_MEM;
+            if ((res == STATUS_OK) && (pRoot != NULL))
+                res = order_styles(&list, pRoot);
+            for (size_t i=0, n=vs.size(); (res == STATUS_OK) && (i<n); ++i)
+                res = order_styles(&list, vs.uget(i));
+            for (size_t i=0, n=list.size(); i<n; ++i)
+                list.uget(i)->nFlags   &= ~Style::S_VISITED;
+
+            if (res != STATUS_OK)
+            {
+                // Fall back to the recursive synchronization
+                nFlags &= ~S_TRANSACTION;
+                if (pRoot != NULL)
+                {
+                    pRoot->invalidate_cache();
+                    pRoot->synchronize();
+                }
+                for (size_t i=0, n=list.size(); i<n; ++i)
+                    list.uget(i)->delayed_notify();
+                return res;
+            }
+
+            // Synchronize styles in order when each parent goes before it's children,
+            // listeners are only marked for notification
+            for (size_t i=0, n=list.size(); i<n; ++i)
+                list.uget(i)->vCache.clear();
+            for (ssize_t i=list.size() - 1; i >= 0; --i)
+                list.uget(i)->sync_properties();
+
+            // Issue single notification for each changed property of each listener
+            nFlags &= ~S_TRANSACTION;
+            for (ssize_t i=list.size() - 1; i >= 0; --i)
+                list.uget(i)->delayed_notify();
+
+            return STATUS_OK;
         }
 
         status_t Schema::apply_internal(StyleSheet *sheet)
@@ -174,7 +238,8 @@ namespace lsp
                 }
             }
 
-            // Destroy all relations between styles
+            // Destroy all relations between styles of the schema, styles of widgets
+            // remain bound to their class styles
             status_t res;
             lltl::parray<Style> vs;
             if (!vStyles.values(&vs))
@@ -184,7 +249,6 @@ namespace lsp
             {
                 Style *s = vs.uget(i);
                 s->remove_all_parents();
-                s->remove_all_children();
             }
 
             // Initialize each style
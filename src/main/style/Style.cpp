@@ -31,6 +31,7 @@ namespace lsp
         {
             pSchema     = schema;
             nFlags      = 0;
+            nCacheStamp = 0;
         }
         
         Style::~Style()
@@ -63,12 +64,14 @@ namespace lsp
             }
 
             // Unlink from children and remove all parents
+            size_t stamp = next_cache_stamp();
             for (size_t i=0, n=vChildren.size(); i<n; ++i)
             {
                 Style *child = vChildren.uget(i);
                 if (child != NULL)
                 {
                     child->vParents.premove(this);
+                    child->invalidate_cache(stamp);
                     child->synchronize();
                 }
             }
@@ -82,6 +85,7 @@ namespace lsp
             for (size_t i=0, n=vProperties.size(); i<n; ++i)
                 undef_property(vProperties.uget(i));
             vProperties.flush();
+            vCache.flush();
         }
 
         void Style::undef_property(property_t *property)
@@ -115,6 +119,11 @@ namespace lsp
             return (pSchema != NULL) ? pSchema->config_mode() : false;
         }
 
+        bool Style::transaction_mode() const
+        {
+            return (pSchema != NULL) ? pSchema->transaction_mode() : false;
+        }
+
         bool Style::set_override(bool set)
         {
             bool res = nFlags & S_OVERRIDE;
@@ -215,7 +224,7 @@ namespace lsp
         Style::property_t *Style::create_property(atom_t id, const property_t *src, size_t flags)
         {
             // Allocate property
-            property_t *dst = vProperties.add();
+            property_t *dst = alloc_property(id);
             if (dst == NULL)
                 return NULL;
 
@@ -240,7 +249,7 @@ namespace lsp
                     // Update value
                     if ((dst->v.sValue = ::strdup(src->v.sValue)) == NULL)
                     {
-                        vProperties.premove(dst);
+                        free_property(dst);
                         return NULL;
                     }
 
@@ -250,12 +259,13 @@ namespace lsp
                     {
                         ::free(dst->v.sValue);
                         dst->v.sValue   = NULL;
-                        vProperties.premove(dst);
+                        free_property(dst);
                         return NULL;
                     }
                     break;
                 }
                 default:
+                    free_property(dst);
                     return NULL;
             }
 
@@ -272,7 +282,7 @@ namespace lsp
         Style::property_t *Style::create_property(atom_t id, property_type_t type, size_t flags)
         {
             // Allocate property
-            property_t *dst = vProperties.add();
+            property_t *dst = alloc_property(id);
             if (dst == NULL)
                 return NULL;
 
@@ -294,18 +304,19 @@ namespace lsp
                 case PT_STRING:
                     if ((dst->v.sValue = ::strdup("")) == NULL)
                     {
-                        vProperties.premove(dst);
+                        free_property(dst);
                         return NULL;
                     }
                     if ((dst->dv.sValue = ::strdup("")) == NULL)
                     {
                         ::free(dst->v.sValue);
                         dst->v.sValue   = NULL;
-                        vProperties.premove(dst);
+                        free_property(dst);
                         return NULL;
                     }
                     break;
                 default:
+                    free_property(dst);
                     return NULL;
             }
 
@@ -381,12 +392,21 @@ namespace lsp
             return STATUS_OK;
         }
 
-        void Style::synchronize()
+        void Style::sync_properties()
         {
             // For each property: copy value from parent and notify children and listeners for changes
             property_t *vp = vProperties.array();
             for (size_t i=0, n=vProperties.size(); i < n; ++i)
                 sync_property(&vp[i]);
+        }
+
+        void Style::synchronize()
+        {
+            // Schema synchronizes all styles at once after the transaction
+            if (transaction_mode())
+                return;
+
+            sync_properties();
 
             // Call all children for synchronize()
             for (size_t i=0, n=vChildren.size(); i<n; ++i)
@@ -451,6 +471,10 @@ namespace lsp
 
         void Style::notify_children(property_t *prop)
         {
+            // In schema transaction, children will be synchronized after the transaction
+            if (transaction_mode())
+                return;
+
             // In transaction, just set notification flag instead of issuing notification procedure
             if ((vLocks.size() > 0) && (prop->owner == this))
             {
@@ -494,6 +518,21 @@ namespace lsp
         {
             atom_t id = prop->id;
 
+            // In schema transaction, just mark listeners for pending property change event
+            if (transaction_mode())
+            {
+                for (size_t i=0, n=vListeners.size(); i<n; ++i)
+                {
+                    listener_t *lst = vListeners.uget(i);
+                    if ((lst != NULL) && (lst->nId == id))
+                    {
+                        lst->bNotify    = true;
+                        prop->flags    |= F_NTF_LISTENERS;
+                    }
+                }
+                return;
+            }
+
             // Check whether we are in transactional state
             if ((vLocks.size() > 0) && (prop->owner == this))
             {
@@ -579,6 +618,7 @@ namespace lsp
             }
 
             // Synchronize state
+            child->invalidate_cache();
             child->synchronize();
 
             return STATUS_OK;
@@ -610,6 +650,7 @@ namespace lsp
             }
 
             // Synchronize state
+            invalidate_cache();
             synchronize();
 
             return STATUS_OK;
@@ -624,6 +665,7 @@ namespace lsp
                 return STATUS_NOT_FOUND;
 
             child->vParents.premove(this);
+            child->invalidate_cache();
             child->synchronize();
 
             return STATUS_OK;
@@ -639,11 +681,15 @@ namespace lsp
             children.swap(vChildren);
 
             // Remove self from parent list of each child
+            size_t stamp = next_cache_stamp();
             for (size_t i=0, n=children.size(); i < n; ++i)
             {
                 Style *child = children.uget(i);
                 if (child != NULL)
+                {
                     child->vParents.premove(this);
+                    child->invalidate_cache(stamp);
+                }
             }
 
             // Synchronize children
@@ -666,6 +712,7 @@ namespace lsp
                 return STATUS_NOT_FOUND;
 
             parent->vChildren.premove(this);
+            invalidate_cache();
             synchronize();
 
             return STATUS_OK;
@@ -689,6 +736,7 @@ namespace lsp
             }
 
             // Synchronize state
+            invalidate_cache();
             synchronize();
 
             return STATUS_OK;
@@ -787,7 +835,7 @@ namespace lsp
                 if (lst == NULL)
                 {
                     undef_property(p);
-                    vProperties.premove(p);
+                    free_property(p);
                     return STATUS_NO_MEM;
                 }
             }
@@ -886,21 +934,128 @@ namespace lsp
             undef_property(p);
             property_t *parent = get_parent_property(p->id);
             notify_children((parent != NULL) ? parent : p);
+            free_property(p);
+        }
+
+        size_t Style::property_index(atom_t id) const
+        {
+            // Binary search for the first property with identifier not less than specified
+            size_t first = 0, last = vProperties.size();
+            const property_t *vp = vProperties.array();
+            while (first < last)
+            {
+                size_t mid      = (first + last) >> 1;
+                if (vp[mid].id < id)
+                    first           = mid + 1;
+                else
+                    last            = mid;
+            }
+            return first;
+        }
+
+        size_t Style::cache_index(atom_t id) const
+        {
+            // Binary search for the first cache entry with identifier not less than specified
+            size_t first = 0, last = vCache.size();
+            const cache_t *vc = vCache.array();
+            while (first < last)
+            {
+                size_t mid      = (first + last) >> 1;
+                if (vc[mid].nId < id)
+                    first           = mid + 1;
+                else
+                    last            = mid;
+            }
+            return first;
+        }
+
+        Style::property_t *Style::alloc_property(atom_t id)
+        {
+            // Keep the list of properties sorted
+            property_t *p = vProperties.insert(property_index(id));
+            if (p == NULL)
+                return NULL;
+
+            // The set of properties visible by children has changed
+            p->id       = id;
+            p->type     = PT_UNKNOWN;
+            invalidate_children_cache();
+
+            return p;
+        }
+
+        void Style::free_property(property_t *p)
+        {
             vProperties.premove(p);
+            invalidate_children_cache();
         }
 
-        Style::property_t *Style::get_property(atom_t id)
+        size_t Style::next_cache_stamp()
         {
-            for (size_t i=0, n=vProperties.size(); i<n; ++i)
+            static size_t stamp = 0;
+            if ((++stamp) == 0) // Zero stamp is never used for invalidation pass
+                ++stamp;
+            return stamp;
+        }
+
+        void Style::invalidate_cache()
+        {
+            invalidate_cache(next_cache_stamp());
+        }
+
+        void Style::invalidate_cache(size_t stamp)
+        {
+            // Descendants reachable by several paths are processed only once per pass
+            if (nCacheStamp == stamp)
+                return;
+            nCacheStamp     = stamp;
+
+            vCache.clear();
+            invalidate_children_cache(stamp);
+        }
+
+        void Style::invalidate_children_cache()
+        {
+            invalidate_children_cache(next_cache_stamp());
+        }
+
+        void Style::invalidate_children_cache(size_t stamp)
+        {
+            for (size_t i=0, n=vChildren.size(); i<n; ++i)
             {
-                property_t *p   = vProperties.uget(i);
-                if ((p != NULL) && (p->id == id))
-                    return p;
+                Style *child = vChildren.uget(i);
+                if (child != NULL)
+                    child->invalidate_cache(stamp);
             }
-            return NULL;
+        }
+
+        Style::property_t *Style::get_property(atom_t id)
+        {
+            size_t idx      = property_index(id);
+            property_t *p   = vProperties.get(idx);
+            return ((p != NULL) && (p->id == id)) ? p : NULL;
         }
 
         Style::property_t *Style::get_parent_property(atom_t id)
+        {
+            // Lookup the resolution cache first
+            size_t idx      = cache_index(id);
+            cache_t *c      = vCache.get(idx);
+            if ((c != NULL) && (c->nId == id))
+                return (c->pOwner != NULL) ? c->pOwner->get_property(id) : NULL;
+
+            // Resolve property and cache the result
+            property_t *p   = resolve_parent_property(id);
+            if ((c = vCache.insert(idx)) != NULL)
+            {
+                c->nId          = id;
+                c->pOwner       = (p != NULL) ? p->owner : NULL;
+            }
+
+            return p;
+        }
+
+        Style::property_t *Style::resolve_parent_property(atom_t id)
         {
             // Lookup parents in reverse order
             for (ssize_t i=vParents.size() - 1; i >= 0; --i)
@@ -25,10 +25,62 @@ namespace lsp
 {
     namespace tk
     {
+        typedef struct builtin_atom_t
+        {
+            const char                 *name;       // Property name
+            const prop::desc_t         *desc;       // Descriptor of the multi-property, may be NULL
+            const char * const         *flags;      // Flags of the flags property, may be NULL
+        } builtin_atom_t;
+
+        /**
+         * The list of properties most frequently bound by widgets,
+         * these are pre-interned when the atom collection is created.
+         * Postfixes are taken from the descriptors of the property classes,
+         * simple properties have neither descriptor nor flags.
+         */
+        static const builtin_atom_t builtin_atoms[] =
+        {
+            // Basic widget properties
+            { "allocation",             NULL,                       Allocation::FLAGS   },
+            { "size.scaling",           NULL,                       NULL                },
+            { "brightness",             NULL,                       NULL                },
+            { "padding",                Padding::DESC,              NULL                },
+            { "bg.color",               Color::DESC,                NULL                },
+            { "visible",                NULL,                       NULL                },
+            { "pointer",                NULL,                       NULL                },
+
+            // Commonly used properties
+            { "color",                  Color::DESC,                NULL                },
+            { "text.color",             Color::DESC,                NULL                },
+            { "border.color",           Color::DESC,                NULL                },
+            { "hover.color",            Color::DESC,                NULL                },
+            { "hole.color",             Color::DESC,                NULL                },
+            { "border.gap.color",       Color::DESC,                NULL                },
+            { "font",                   Font::DESC,                 NULL                },
+            { "size.constraints",       SizeConstraints::DESC,      NULL                },
+            { "text.layout",            TextLayout::DESC,           NULL                },
+            { "layout",                 Layout::DESC,               NULL                },
+            { "border.size",            NULL,                       NULL                },
+            { "border.radius",          NULL,                       NULL                },
+            { "border.gap.size",        NULL,                       NULL                },
+            { "value",                  NULL,                       NULL                },
+            { "angle",                  NULL,                       NULL                },
+            { "size",                   NULL,                       NULL                },
+            { "step",                   NULL,                       NULL                },
+            { "spacing",                NULL,                       NULL                },
+            { "orientation",            NULL,                       NULL                },
+
+            { NULL,                     NULL,                       NULL                }
+        };
+
         Atoms::Atoms()
         {
+            vIndex      = NULL;
+            nCapacity   = 0;
+
+            init_builtin();
         }
-        
+
         Atoms::~Atoms()
         {
             // Destroy atoms
@@ -39,6 +91,119 @@ namespace lsp
                     ::free(ptr);
             }
             vAtoms.flush();
+
+            // Destroy index
+            if (vIndex != NULL)
+            {
+                ::free(vIndex);
+                vIndex      = NULL;
+            }
+            nCapacity   = 0;
+        }
+
+        bool Atoms::init_builtin(LSPString *key, size_t len, const char *postfix)
+        {
+            key->set_length(len);
+            if (!key->append_ascii(postfix))
+                return false;
+            return atom_id(key->get_utf8()) >= 0;
+        }
+
+        void Atoms::init_builtin()
+        {
+            LSPString key;
+
+            for (const builtin_atom_t *a = builtin_atoms; a->name != NULL; ++a)
+            {
+                if (!key.set_ascii(a->name))
+                    return;
+                size_t len = key.length();
+
+                if (a->desc != NULL)
+                {
+                    for (const prop::desc_t *d = a->desc; d->postfix != NULL; ++d)
+                        if (!init_builtin(&key, len, d->postfix))
+                            return;
+                }
+                else if (a->flags != NULL)
+                {
+                    for (const char * const *f = a->flags; *f != NULL; ++f)
+                        if (!init_builtin(&key, len, *f))
+                            return;
+                }
+                else if (!init_builtin(&key, len, ""))
+                    return;
+            }
+        }
+
+        size_t Atoms::hash_name(const char *name)
+        {
+            // FNV-1a hash function
+            size_t hash = 2166136261U;
+            for (const uint8_t *p = reinterpret_cast<const uint8_t *>(name); *p != 0; ++p)
+                hash    = (hash ^ *p) * 16777619U;
+            return hash;
+        }
+
+        Atoms::bucket_t *Atoms::lookup(const char *name, size_t hash) const
+        {
+            // Linear probing, the index always has at least one empty bucket
+            size_t mask = nCapacity - 1;
+            for (size_t i = hash & mask; ; i = (i + 1) & mask)
+            {
+                bucket_t *b = &vIndex[i];
+                if (b->nId < 0)
+                    return b;
+                if ((b->nHash == hash) && (!::strcmp(vAtoms.uget(b->nId), name)))
+                    return b;
+            }
+        }
+
+        bool Atoms::grow_index()
+        {
+            // Allocate new index
+            size_t cap          = (nCapacity > 0) ? nCapacity << 1 : 0x100;
+            bucket_t *index     = static_cast<bucket_t *>(::malloc(cap * sizeof(bucket_t)));
+            if (index == NULL)
+                return false;
+            for (size_t i=0; i<cap; ++i)
+            {
+                index[i].nHash      = 0;
+                index[i].nId        = -1;
+            }
+
+            // Re-hash all existing atoms
+            size_t mask = cap - 1;
+            for (size_t i=0; i<nCapacity; ++i)
+            {
+                const bucket_t *b = &vIndex[i];
+                if (b->nId < 0)
+                    continue;
+
+                size_t j = b->nHash & mask;
+                while (index[j].nId >= 0)
+                    j = (j + 1) & mask;
+                index[j]    = *b;
+            }
+
+            // Commit new index
+            if (vIndex != NULL)
+                ::free(vIndex);
+            vIndex      = index;
+            nCapacity   = cap;
+
+            return true;
+        }
+
+        atom_t Atoms::find_atom(const char *name) const
+        {
+            if (name == NULL)
+                return -STATUS_BAD_ARGUMENTS;
+            if (vIndex == NULL)
+                return -STATUS_NOT_FOUND;
+
+            const bucket_t *b = lookup(name, hash_name(name));
+            return (b->nId >= 0) ? b->nId : -STATUS_NOT_FOUND;
         }
 
         atom_t Atoms::atom_id(const char *name)
@@ -47,12 +212,18 @@ namespace lsp
                 return -STATUS_BAD_ARGUMENTS;
 
             // Find existing atom
-            size_t last = vAtoms.size();
-            for (size_t i=0; i<last; ++i)
+            size_t hash         = hash_name(name);
+            bucket_t *b         = (vIndex != NULL) ? lookup(name, hash) : NULL;
+            if ((b != NULL) && (b->nId >= 0))
+                return b->nId;
+
+            // Keep the load factor of the index not greater than 3/4
+            size_t last         = vAtoms.size();
+            if (((last + 1) << 2) > (nCapacity * 3))
             {
-                const char *aname = vAtoms.uget(i);
-                if (!::strcmp(aname, name))
-                    return i;
+                if (!grow_index())
+                    return -STATUS_NO_MEM;
+                b                   = lookup(name, hash);
             }
 
             // Allocate new atom name
@@ -60,13 +231,17 @@ namespace lsp
             if (aname == NULL)
                 return -STATUS_NO_MEM;
 
-            // Insert atom name to the found position
+            // Insert atom name to the end of list
             if (!vAtoms.add(aname))
             {
                 ::free(aname);
                 return -STATUS_NO_MEM;
             }
 
+            // Register atom in the index
+            b->nHash            = hash;
+            b->nId              = last;
+
             return last;
         }
     
@@ -36,12 +36,34 @@ namespace lsp
             pDisplay        = NULL;
             pResourceLoader = NULL;
             pEnv            = NULL;
+            nFrameTask      = -1;
+            nLastFrame      = 0;
+            nFrameRate      = LSP_TK_FRAME_RATE_DFL;
+            nFrameError     = 0;
+            vIdBins         = NULL;
+            vPtrBins        = NULL;
+            nBins           = 0;
+            nFrameStamp     = 0;
+            pSurfHead       = NULL;
+            pSurfTail       = NULL;
+
+            sSurfaceStats.nSurfaces     = 0;
+            sSurfaceStats.nPooled       = 0;
+            sSurfaceStats.nBytes        = 0;
+            sSurfaceStats.nPoolBytes    = 0;
+            sSurfaceStats.nPeakBytes    = 0;
+            sSurfaceStats.nLimit        = 0;
+            sSurfaceStats.nAllocated    = 0;
+            sSurfaceStats.nReused       = 0;
+            sSurfaceStats.nEvicted      = 0;
 
             // Apply custom settings
             if (settings != NULL)
             {
                 pResourceLoader     = settings->resources;
                 pEnv                = (settings->environment != NULL) ? settings->environment->clone() : NULL;
+                set_frame_rate(settings->frame_rate);
+                set_surface_limit(settings->surface_limit);
             }
         }
 
@@ -58,6 +80,13 @@ namespace lsp
 
         void Display::do_destroy()
         {
+            // Cancel frame rendering
+            if ((nFrameTask >= 0) && (pDisplay != NULL))
+                pDisplay->cancel_task(nFrameTask);
+            nFrameTask      = -1;
+            vDirty.flush();
+            vRendering.flush();
+
             // Auto-destruct widgets
             size_t n    = sWidgets.size();
             for (size_t i=0; i<n; ++i)
@@ -76,6 +105,29 @@ namespace lsp
                 ::free(ptr);
             }
             sWidgets.flush();
+            vPending.flush();
+
+            // Destroy surfaces
+            pSurfHead       = NULL;
+            pSurfTail       = NULL;
+            sSurfaceStats.nSurfaces     = 0;
+            drop_surface_pool();
+            drop_window_pool();
+            sSurfaceCache.flush();
+            sSchema.text_cache()->flush();
+
+            // Destroy widget indexes
+            if (vIdBins != NULL)
+            {
+                ::free(vIdBins);
+                vIdBins         = NULL;
+            }
+            if (vPtrBins != NULL)
+            {
+                ::free(vPtrBins);
+                vPtrBins        = NULL;
+            }
+            nBins           = 0;
 
             // Execute slot
             sSlots.execute(SLOT_DESTROY, NULL);
@@ -114,6 +166,330 @@ namespace lsp
             return STATUS_OK;
         }
 
+        status_t Display::frame_task_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg)
+        {
+            Display *_this   = static_cast<Display *>(arg);
+            if (_this == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            _this->nFrameTask   = -1;
+            _this->render_frame(time);
+
+            return STATUS_OK;
+        }
+
+        void Display::render_frame(ws::timestamp_t time)
+        {
+            nLastFrame      = time;
+            ++nFrameStamp;
+
+            // Take the list of pending windows, new requests issued while
+            // rendering will be processed at the next frame. Windows that
+            // are destroyed while rendering are removed by cancel_frame()
+            vRendering.swap(&vDirty);
+
+            while (!vRendering.is_empty())
+            {
+                Window *wnd     = vRendering.pop();
+                if (wnd != NULL)
+                    wnd->do_render();
+            }
+
+            // Schedule next frame if there are new requests
+            if (vDirty.size() > 0)
+                schedule_frame();
+        }
+
+        void Display::schedule_frame()
+        {
+            if ((nFrameTask >= 0) || (pDisplay == NULL))
+                return;
+
+            // Do not render frames faster than the target frame rate, the fractional
+            // part of the period is accumulated to keep the average frame rate exact
+            size_t delay            = 1000 + nFrameError;
+            ws::timestamp_t time    = nLastFrame + delay / nFrameRate;
+            ws::taskid_t id         = pDisplay->submit_task(time, frame_task_handler, this);
+            if (id >= 0)
+            {
+                nFrameTask              = id;
+                nFrameError             = delay % nFrameRate;
+            }
+        }
+
+        status_t Display::request_frame(Window *wnd)
+        {
+            if (wnd == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            if (pDisplay == NULL)
+                return STATUS_BAD_STATE;
+
+            // Add window to the list if it is not present
+            if (vDirty.index_of(wnd) < 0)
+            {
+                if (!vDirty.add(wnd))
+                    return STATUS_NO_MEM;
+            }
+
+            schedule_frame();
+            return STATUS_OK;
+        }
+
+        void Display::cancel_frame(Window *wnd)
+        {
+            vDirty.premove(wnd);
+            vRendering.premove(wnd);
+
+            // Cancel the frame task if there is nothing to render
+            if ((vDirty.size() <= 0) && (nFrameTask >= 0) && (pDisplay != NULL))
+            {
+                pDisplay->cancel_task(nFrameTask);
+                nFrameTask      = -1;
+            }
+        }
+
+        void Display::set_frame_rate(size_t rate)
+        {
+            if (rate <= 0)
+                rate            = LSP_TK_FRAME_RATE_DFL;
+            nFrameRate      = lsp_min(rate, size_t(LSP_TK_FRAME_RATE_MAX));
+            nFrameError     = 0;
+        }
+
+        ws::ISurface *Display::alloc_surface(Widget *widget, ws::ISurface *s, size_t width, size_t height)
+        {
+            if ((s == NULL) || (widget == NULL))
+                return NULL;
+
+            wsize_t bytes       = wsize_t(width) * height * sizeof(uint32_t);
+            ws::ISurface *res   = NULL;
+
+            // Lookup for idle surface of the same size
+            for (size_t i=0, n=vSurfacePool.size(); i<n; ++i)
+            {
+                ws::ISurface *x     = vSurfacePool.uget(i);
+                if ((x->width() != width) || (x->height() != height))
+                    continue;
+
+                vSurfacePool.qremove(i);
+                sSurfaceStats.nPoolBytes   -= bytes;
+                ++sSurfaceStats.nReused;
+
+                // Make the surface look like newly created one: fully transparent
+                Color c(0.0f, 0.0f, 0.0f, 1.0f);
+                x->clear(c);
+                res                 = x;
+                break;
+            }
+
+            // Create new surface if there is no suitable one
+            if (res == NULL)
+            {
+                if ((res = s->create(width, height)) == NULL)
+                    return NULL;
+                ++sSurfaceStats.nAllocated;
+            }
+
+            // Register the surface
+            link_surface(widget);
+            sSurfaceStats.nBytes       += bytes;
+            sSurfaceStats.nPeakBytes    = lsp_max(sSurfaceStats.nPeakBytes, sSurfaceStats.nBytes + sSurfaceStats.nPoolBytes);
+
+            // Free some memory if the limit has been exceeded
+            if ((sSurfaceStats.nLimit > 0) && ((sSurfaceStats.nBytes + sSurfaceStats.nPoolBytes) > sSurfaceStats.nLimit))
+                evict_surfaces();
+
+            return res;
+        }
+
+        void Display::release_surface(Widget *widget, ws::ISurface *surface)
+        {
+            if (surface == NULL)
+                return;
+
+            wsize_t bytes       = wsize_t(surface->width()) * surface->height() * sizeof(uint32_t);
+            if (unlink_surface(widget))
+                sSurfaceStats.nBytes       -= bytes;
+
+            // Keep the surface for further re-use if possible
+            if ((pDisplay != NULL) && (vSurfacePool.size() < LSP_TK_SURFACE_POOL_MAX))
+            {
+                wsize_t total       = sSurfaceStats.nBytes + sSurfaceStats.nPoolBytes + bytes;
+                if ((sSurfaceStats.nLimit <= 0) || (total <= sSurfaceStats.nLimit))
+                {
+                    if (vSurfacePool.add(surface))
+                    {
+                        sSurfaceStats.nPoolBytes   += bytes;
+                        return;
+                    }
+                }
+            }
+
+            surface->destroy();
+            delete surface;
+        }
+
+        void Display::drop_surface_pool()
+        {
+            for (size_t i=0, n=vSurfacePool.size(); i<n; ++i)
+            {
+                ws::ISurface *s     = vSurfacePool.uget(i);
+                if (s == NULL)
+                    continue;
+                s->destroy();
+                delete s;
+            }
+            vSurfacePool.flush();
+            sSurfaceStats.nPoolBytes    = 0;
+        }
+
+        ws::IWindow *Display::acquire_window(size_t screen)
+        {
+            if (pDisplay == NULL)
+                return NULL;
+
+            // Lookup for idle window on the same screen
+            for (size_t i=0, n=vWindowPool.size(); i<n; ++i)
+            {
+                ws::IWindow *wnd    = vWindowPool.uget(i);
+                if (wnd->screen() != screen)
+                    continue;
+
+                vWindowPool.qremove(i);
+                return wnd;
+            }
+
+            // Create new window
+            ws::IWindow *wnd    = pDisplay->create_window(screen);
+            if (wnd == NULL)
+                return NULL;
+
+            if (wnd->init() != STATUS_OK)
+            {
+                wnd->destroy();
+                delete wnd;
+                return NULL;
+            }
+
+            return wnd;
+        }
+
+        void Display::release_window(ws::IWindow *wnd)
+        {
+            if (wnd == NULL)
+                return;
+
+            wnd->hide();
+            wnd->set_handler(NULL);
+
+            // Keep the window for further re-use if possible
+            if ((pDisplay != NULL) && (vWindowPool.size() < LSP_TK_WINDOW_POOL_MAX))
+            {
+                if (vWindowPool.add(wnd))
+                    return;
+            }
+
+            wnd->destroy();
+            delete wnd;
+        }
+
+        void Display::drop_window_pool()
+        {
+            for (size_t i=0, n=vWindowPool.size(); i<n; ++i)
+            {
+                ws::IWindow *wnd    = vWindowPool.uget(i);
+                if (wnd == NULL)
+                    continue;
+                wnd->destroy();
+                delete wnd;
+            }
+            vWindowPool.flush();
+        }
+
+        void Display::link_surface(Widget *widget)
+        {
+            // Append the widget to the tail of the LRU list
+            widget->pSurfPrev   = pSurfTail;
+            widget->pSurfNext   = NULL;
+            if (pSurfTail != NULL)
+                pSurfTail->pSurfNext    = widget;
+            else
+                pSurfHead       = widget;
+            pSurfTail       = widget;
+            ++sSurfaceStats.nSurfaces;
+        }
+
+        bool Display::unlink_surface(Widget *widget)
+        {
+            // Check that the widget is linked
+            if ((widget->pSurfPrev == NULL) && (pSurfHead != widget))
+                return false;
+
+            if (widget->pSurfPrev != NULL)
+                widget->pSurfPrev->pSurfNext    = widget->pSurfNext;
+            else
+                pSurfHead       = widget->pSurfNext;
+            if (widget->pSurfNext != NULL)
+                widget->pSurfNext->pSurfPrev    = widget->pSurfPrev;
+            else
+                pSurfTail       = widget->pSurfPrev;
+
+            widget->pSurfPrev   = NULL;
+            widget->pSurfNext   = NULL;
+            --sSurfaceStats.nSurfaces;
+            return true;
+        }
+
+        void Display::touch_surface(Widget *widget)
+        {
+            if ((widget == NULL) || (widget == pSurfTail))
+                return;
+            if (unlink_surface(widget))
+                link_surface(widget);
+        }
+
+        void Display::evict_surfaces()
+        {
+            // Idle surfaces are dropped first
+            drop_surface_pool();
+
+            // Evict least recently used surfaces. The LRU list is ordered by the frame stamp,
+            // so widgets rendered in the current frame are all at the tail of the list
+            Widget *w           = pSurfHead;
+            while ((w != NULL) && (sSurfaceStats.nBytes > sSurfaceStats.nLimit))
+            {
+                if (w->nSurfaceStamp == nFrameStamp)
+                    break;
+
+                Widget *next        = w->pSurfNext;
+                if (w->pSurface != NULL)
+                {
+                    w->drop_surface();
+                    ++sSurfaceStats.nEvicted;
+                }
+                w                   = next;
+            }
+
+            // Do not keep released surfaces in the pool
+            drop_surface_pool();
+        }
+
+        void Display::set_surface_limit(wsize_t limit)
+        {
+            sSurfaceStats.nLimit        = limit;
+            if ((limit > 0) && ((sSurfaceStats.nBytes + sSurfaceStats.nPoolBytes) > limit))
+                evict_surfaces();
+        }
+
+        void Display::get_surface_stats(surface_stats_t *stats) const
+        {
+            if (stats == NULL)
+                return;
+
+            *stats                      = sSurfaceStats;
+            stats->nPooled              = vSurfacePool.size();
+        }
+
         void Display::garbage_collect()
         {
             for (size_t i=0, n=vGarbage.size(); i<n; ++i)
@@ -123,21 +499,9 @@ namespace lsp
                 if (w == NULL)
                     continue;
 
-                // Widget is registered?
-                for (size_t j=0, m=sWidgets.size(); j<m; )
-                {
-                    item_t *item = sWidgets.uget(j);
-                    if (item->widget == w)
-                    {
-                        // Free the binding
-                        sWidgets.qremove(j);
-                        item->id        = NULL;
-                        item->widget    = NULL;
-                        ::free(item);
-                    }
-                    else
-                        ++j;
-                }
+                // Widget is registered? Free all bindings
+                for (item_t *item = find_ptr(w); item != NULL; item = find_ptr(w))
+                    remove_item(item);
 
                 // Destroy widget
                 w->destroy();
@@ -295,24 +659,182 @@ namespace lsp
 
         status_t Display::add(Widget *widget, const char *id)
         {
-            Widget **w = add(id);
+            item_t *w = add_item(id);
             if (w == NULL)
                 return STATUS_NO_MEM;
 
-            *w = widget;
+            w->widget       = widget;
+            if (widget != NULL)
+            {
+                w->pIndexed     = widget;
+                link_ptr(w);
+            }
+            else if (!vPending.add(w))
+            {
+                remove_item(w);
+                return STATUS_NO_MEM;
+            }
+
             return STATUS_OK;
         }
 
-        Widget **Display::add(const char *id)
+        bool Display::grow_index()
         {
-            // Prevent from duplicates
-            if (id != NULL)
+            // Allocate new bins
+            size_t bins         = (nBins > 0) ? nBins << 1 : 0x40;
+            item_t **id_bins    = static_cast<item_t **>(::malloc(bins * sizeof(item_t *) * 2));
+            if (id_bins == NULL)
+                return false;
+            item_t **ptr_bins   = &id_bins[bins];
+            for (size_t i=0; i<bins; ++i)
             {
-                // Check that widget does not exist
-                Widget *widget = get(id);
-                if (widget != NULL)
-                    return NULL;
+                id_bins[i]          = NULL;
+                ptr_bins[i]         = NULL;
+            }
+
+            // Replace the index
+            if (vIdBins != NULL)
+                ::free(vIdBins);
+            vIdBins             = id_bins;
+            vPtrBins            = ptr_bins;
+            nBins               = bins;
+
+            // Re-index all items
+            for (size_t i=0, n=sWidgets.size(); i<n; ++i)
+            {
+                item_t *item        = sWidgets.uget(i);
+                if (item->id != NULL)
+                    link_id(item);
+                if (item->pIndexed != NULL)
+                    link_ptr(item);
+            }
+
+            return true;
+        }
+
+        void Display::link_id(item_t *item)
+        {
+            item_t **bin        = &vIdBins[item->nHash & (nBins - 1)];
+            item->pIdNext       = *bin;
+            *bin                = item;
+        }
+
+        void Display::link_ptr(item_t *item)
+        {
+            item_t **bin        = &vPtrBins[hash_ptr(item->pIndexed) & (nBins - 1)];
+            item->pPtrNext      = *bin;
+            *bin                = item;
+        }
+
+        void Display::unlink_id(item_t *item)
+        {
+            for (item_t **p = &vIdBins[item->nHash & (nBins - 1)]; *p != NULL; p = &(*p)->pIdNext)
+            {
+                if (*p == item)
+                {
+                    *p                  = item->pIdNext;
+                    item->pIdNext       = NULL;
+                    return;
+                }
+            }
+        }
+
+        void Display::unlink_ptr(item_t *item)
+        {
+            for (item_t **p = &vPtrBins[hash_ptr(item->pIndexed) & (nBins - 1)]; *p != NULL; p = &(*p)->pPtrNext)
+            {
+                if (*p == item)
+                {
+                    *p                  = item->pPtrNext;
+                    item->pPtrNext      = NULL;
+                    item->pIndexed      = NULL;
+                    return;
+                }
+            }
+        }
+
+        void Display::sync_pending()
+        {
+            // Index items which have got the widget pointer after the registration
+            for (size_t i=0; i<vPending.size(); )
+            {
+                item_t *item        = vPending.uget(i);
+                if (item->widget == NULL)
+                {
+                    ++i;
+                    continue;
+                }
+
+                item->pIndexed      = item->widget;
+                link_ptr(item);
+                vPending.qremove(i);
             }
+        }
+
+        Display::item_t *Display::find_id(const char *id)
+        {
+            if (nBins <= 0)
+                return NULL;
+
+            size_t hash         = hash_name(id);
+            for (item_t *item = vIdBins[hash & (nBins - 1)]; item != NULL; item = item->pIdNext)
+            {
+                if ((item->nHash == hash) && (!strcmp(item->id, id)))
+                    return item;
+            }
+
+            return NULL;
+        }
+
+        Display::item_t *Display::find_ptr(const Widget *widget)
+        {
+            if ((nBins <= 0) || (widget == NULL))
+                return NULL;
+
+            sync_pending();
+            for (item_t *item = vPtrBins[hash_ptr(widget) & (nBins - 1)]; item != NULL; item = item->pPtrNext)
+            {
+                if (item->pIndexed == widget)
+                    return item;
+            }
+
+            return NULL;
+        }
+
+        void Display::remove_item(item_t *item)
+        {
+            // Remove from indexes
+            if (item->id != NULL)
+                unlink_id(item);
+            if (item->pIndexed != NULL)
+                unlink_ptr(item);
+            else
+                vPending.premove(item);
+
+            // Remove from the list of widgets, the order of widgets is not preserved
+            size_t last         = sWidgets.size() - 1;
+            if (item->nIndex < last)
+            {
+                item_t *moved       = sWidgets.uget(last);
+                moved->nIndex       = item->nIndex;
+            }
+            sWidgets.qremove(item->nIndex);
+
+            // Free the binding
+            item->id            = NULL;
+            item->widget        = NULL;
+            ::free(item);
+        }
+
+        Display::item_t *Display::add_item(const char *id)
+        {
+            // Prevent from duplicates
+            if ((id != NULL) && (find_id(id) != NULL))
+                return NULL;
+
+            // Ensure that index has enough space
+            if ((sWidgets.size() >= nBins) && (!grow_index()))
+                return NULL;
 
             // Allocate memory
             size_t slen     = (id != NULL) ? (::strlen(id) + 1) * sizeof(char) : 0;
@@ -322,39 +844,56 @@ namespace lsp
             item_t *w   = reinterpret_cast<item_t *>(::malloc(to_alloc));
             if (w == NULL)
                 return NULL;
-            else if (!sWidgets.add(w))
+
+            // Initialize widget
+            w->widget       = NULL;
+            w->id           = NULL;
+            w->pIndexed     = NULL;
+            w->nHash        = 0;
+            w->nIndex       = sWidgets.size();
+            w->pIdNext      = NULL;
+            w->pPtrNext     = NULL;
+
+            if (!sWidgets.add(w))
             {
                 ::free(w);
                 return NULL;
             }
 
-            // Initialize widget
-            w->widget       = NULL;
-            w->id           = NULL;
             if (id != NULL)
             {
                 w->id           = reinterpret_cast<char *>(&w[1]);
+                w->nHash        = hash_name(id);
                 ::memcpy(w->id, id, slen);
+                link_id(w);
             }
 
-            return &w->widget;
+            return w;
         }
 
-        Widget *Display::get(const char *id)
+        Widget **Display::add(const char *id)
         {
-            if (id == NULL)
+            item_t *w   = add_item(id);
+            if (w == NULL)
                 return NULL;
 
-            for (size_t i=0, n=sWidgets.size(); i<n; ++i)
+            // The widget pointer will be written by the caller, defer indexing
+            if (!vPending.add(w))
             {
-                item_t *ptr     = sWidgets.uget(i);
-                if (ptr->id == NULL)
-                    continue;
-                if (!strcmp(ptr->id, id))
-                    return ptr->widget;
+                remove_item(w);
+                return NULL;
             }
 
-            return NULL;
+            return &w->widget;
+        }
+
+        Widget *Display::get(const char *id)
+        {
+            if (id == NULL)
+                return NULL;
+
+            item_t *item    = find_id(id);
+            return (item != NULL) ? item->widget : NULL;
         }
 
         Widget *Display::remove(const char *id)
@@ -362,50 +901,28 @@ namespace lsp
             if (id == NULL)
                 return NULL;
 
-            size_t n    = sWidgets.size();
-            for (size_t i=0; i<n; ++i)
-            {
-                item_t *ptr     = sWidgets.uget(i);
-                if (ptr->id == NULL)
-                    continue;
-                if (!strcmp(ptr->id, id))
-                {
-                    Widget *result = ptr->widget;
-                    sWidgets.remove(i);
-                    return result;
-                }
-            }
+            item_t *item    = find_id(id);
+            if (item == NULL)
+                return NULL;
 
-            return NULL;
+            Widget *result  = item->widget;
+            remove_item(item);
+            return result;
         }
 
         bool Display::remove(Widget *widget)
         {
-            size_t n    = sWidgets.size();
-            for (size_t i=0; i<n; ++i)
-            {
-                item_t *ptr     = sWidgets.uget(i);
-                if (ptr->widget == widget)
-                {
-                    sWidgets.remove(i);
-                    return true;
-                }
-            }
+            item_t *item    = find_ptr(widget);
+            if (item == NULL)
+                return false;
 
-            return false;
+            remove_item(item);
+            return true;
         }
 
         bool Display::exists(Widget *widget)
         {
-            size_t n    = sWidgets.size();
-            for (size_t i=0; i<n; ++i)
-            {
-                item_t *ptr     = sWidgets.uget(i);
-                if (ptr->widget == widget)
-                    return true;
-            }
-
-            return false;
+            return find_ptr(widget) != NULL;
         }
 
         status_t Display::get_clipboard(size_t id, ws::IDataSink *sink)
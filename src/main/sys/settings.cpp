@@ -29,12 +29,16 @@ namespace lsp
         {
             resources       = NULL;
             environment     = NULL;
+            frame_rate      = 0;
+            surface_limit   = 0;
         }
 
         void display_settings_t::construct()
         {
             resources       = NULL;
             environment     = NULL;
+            frame_rate      = 0;
+            surface_limit   = 0;
         }
     }
 }
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/common/alloc.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        ScratchBuffer::ScratchBuffer()
+        {
+            vData           = NULL;
+            pData           = NULL;
+            nCapacity       = 0;
+            nAllocations    = 0;
+        }
+
+        ScratchBuffer::~ScratchBuffer()
+        {
+            flush();
+        }
+
+        float *ScratchBuffer::get(size_t count)
+        {
+            if (count <= nCapacity)
+                return vData;
+
+            // Grow with some reserve to avoid re-allocations on small size changes
+            size_t cap      = lsp::align_size(count + (count >> 1), 0x40);
+            uint8_t *data   = NULL;
+            float *ptr      = lsp::alloc_aligned<float>(data, cap, 0x40);
+            if (ptr == NULL)
+                return NULL;
+
+            if (pData != NULL)
+                lsp::free_aligned(pData);
+
+            vData           = ptr;
+            pData           = data;
+            nCapacity       = cap;
+            ++nAllocations;
+
+            return vData;
+        }
+
+        void ScratchBuffer::flush()
+        {
+            if (pData != NULL)
+            {
+                lsp::free_aligned(pData);
+                pData           = NULL;
+            }
+            vData           = NULL;
+            nCapacity       = 0;
+        }
+    }
+}
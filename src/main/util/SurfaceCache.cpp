@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <stdlib.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        SurfaceCache::SurfaceCache()
+        {
+            nLimit          = 64;
+        }
+
+        SurfaceCache::~SurfaceCache()
+        {
+            flush();
+        }
+
+        void SurfaceCache::destroy_item(item_t *item)
+        {
+            if (item->pSurface != NULL)
+            {
+                item->pSurface->destroy();
+                delete item->pSurface;
+                item->pSurface  = NULL;
+            }
+            ::free(item);
+        }
+
+        void SurfaceCache::evict(size_t limit)
+        {
+            while (vItems.size() > limit)
+            {
+                item_t *item    = vItems.uget(0);
+                vItems.remove(size_t(0));
+                destroy_item(item);
+            }
+        }
+
+        ws::ISurface *SurfaceCache::get(const void *key, size_t size)
+        {
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                item_t *item    = vItems.uget(i);
+                if ((item->nSize != size) || (::memcmp(item->vKey, key, size) != 0))
+                    continue;
+
+                // Move the item to the end of the list as the most recently used
+                if (i < (n-1))
+                {
+                    vItems.remove(i);
+                    vItems.add(item);
+                }
+                return item->pSurface;
+            }
+
+            return NULL;
+        }
+
+        status_t SurfaceCache::put(const void *key, size_t size, ws::ISurface *surface)
+        {
+            if (surface == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            item_t *item    = static_cast<item_t *>(::malloc(sizeof(item_t) + size));
+            if (item == NULL)
+            {
+                surface->destroy();
+                delete surface;
+                return STATUS_NO_MEM;
+            }
+            item->pSurface  = surface;
+            item->nSize     = size;
+            item->vKey      = reinterpret_cast<uint8_t *>(&item[1]);
+            ::memcpy(item->vKey, key, size);
+
+            // Remove previously cached item with the same key
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                item_t *old     = vItems.uget(i);
+                if ((old->nSize != size) || (::memcmp(old->vKey, key, size) != 0))
+                    continue;
+                vItems.remove(i);
+                destroy_item(old);
+                break;
+            }
+
+            // Free space and add item
+            evict(lsp_max(nLimit, size_t(1)) - 1);
+            if (!vItems.add(item))
+            {
+                destroy_item(item);
+                return STATUS_NO_MEM;
+            }
+
+            return STATUS_OK;
+        }
+
+        void SurfaceCache::flush()
+        {
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+                destroy_item(vItems.uget(i));
+            vItems.flush();
+        }
+
+        void SurfaceCache::set_limit(size_t limit)
+        {
+            nLimit          = limit;
+            evict(nLimit);
+        }
+    }
+}
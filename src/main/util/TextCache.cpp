@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include <stdlib.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        TextCache::TextCache()
+        {
+            vBins           = NULL;
+            pHead           = NULL;
+            pTail           = NULL;
+            nItems          = 0;
+            nLimit          = 1024;
+            nHits           = 0;
+            nMisses         = 0;
+        }
+
+        TextCache::~TextCache()
+        {
+            flush();
+        }
+
+        size_t TextCache::hash_key(const char *name, size_t nlen, float size, size_t flags, const lsp_wchar_t *text, size_t tlen)
+        {
+            size_t hash     = size_t(0x811c9dc5U);
+            for (size_t i=0; i<nlen; ++i)
+                hash            = (hash ^ uint8_t(name[i])) * size_t(0x01000193U);
+            for (size_t i=0; i<tlen; ++i)
+                hash            = (hash ^ text[i]) * size_t(0x01000193U);
+
+            uint32_t isize;
+            ::memcpy(&isize, &size, sizeof(isize));
+            hash            = (hash ^ isize) * size_t(0x01000193U);
+            hash            = (hash ^ flags) * size_t(0x01000193U);
+
+            return hash;
+        }
+
+        bool TextCache::normalize(const LSPString *text, ssize_t *first, ssize_t *last)
+        {
+            if (text == NULL)
+                return false;
+
+            ssize_t len     = text->length();
+            ssize_t xfirst  = lsp_limit(*first, ssize_t(0), len);
+            ssize_t xlast   = lsp_limit(*last, xfirst, len);
+            *first          = xfirst;
+            *last           = xlast;
+
+            return true;
+        }
+
+        TextCache::item_t *TextCache::find(const ws::Font *f, const LSPString *text, ssize_t first, ssize_t last, size_t *hash)
+        {
+            const char *name        = f->get_name();
+            if (name == NULL)
+                name                    = "";
+            size_t nlen             = ::strlen(name);
+            size_t tlen             = last - first;
+            float size              = f->get_size();
+            size_t flags            = f->flags();
+            const lsp_wchar_t *chars= text->characters() + first;
+
+            size_t h                = hash_key(name, nlen, size, flags, chars, tlen);
+            *hash                   = h;
+            if (vBins == NULL)
+                return NULL;
+
+            for (item_t *it = vBins[h & (BINS - 1)]; it != NULL; it = it->pBinNext)
+            {
+                if ((it->nHash != h) || (it->nText != tlen) || (it->nName != nlen))
+                    continue;
+                if ((it->fSize != size) || (it->nFlags != flags))
+                    continue;
+                if (::memcmp(it->sName, name, nlen) != 0)
+                    continue;
+                if (::memcmp(it->vText, chars, tlen * sizeof(lsp_wchar_t)) != 0)
+                    continue;
+                return it;
+            }
+
+            return NULL;
+        }
+
+        void TextCache::unlink(item_t *item)
+        {
+            if (item->pPrev != NULL)
+                item->pPrev->pNext  = item->pNext;
+            else
+                pHead               = item->pNext;
+            if (item->pNext != NULL)
+                item->pNext->pPrev  = item->pPrev;
+            else
+                pTail               = item->pPrev;
+
+            item->pPrev         = NULL;
+            item->pNext         = NULL;
+        }
+
+        void TextCache::link_first(item_t *item)
+        {
+            item->pPrev         = NULL;
+            item->pNext         = pHead;
+            if (pHead != NULL)
+                pHead->pPrev        = item;
+            else
+                pTail               = item;
+            pHead               = item;
+        }
+
+        void TextCache::remove(item_t *item)
+        {
+            // Remove from the hash bin
+            item_t **pp         = &vBins[item->nHash & (BINS - 1)];
+            while (*pp != NULL)
+            {
+                if (*pp == item)
+                {
+                    *pp                 = item->pBinNext;
+                    break;
+                }
+                pp                  = &(*pp)->pBinNext;
+            }
+
+            // Remove from the LRU list
+            unlink(item);
+            ::free(item);
+            --nItems;
+        }
+
+        void TextCache::evict(size_t limit)
+        {
+            while ((nItems > limit) && (pTail != NULL))
+                remove(pTail);
+        }
+
+        bool TextCache::get(const ws::Font *f, ws::text_parameters_t *tp, const LSPString *text, ssize_t first, ssize_t last)
+        {
+            if (!normalize(text, &first, &last))
+                return false;
+
+            size_t hash;
+            item_t *item    = find(f, text, first, last, &hash);
+            if (item == NULL)
+            {
+                ++nMisses;
+                return false;
+            }
+
+            // Move the item to the head of the LRU list
+            if (item != pHead)
+            {
+                unlink(item);
+                link_first(item);
+            }
+
+            *tp             = item->sParams;
+            ++nHits;
+            return true;
+        }
+
+        status_t TextCache::put(const ws::Font *f, const ws::text_parameters_t *tp, const LSPString *text, ssize_t first, ssize_t last)
+        {
+            if ((f == NULL) || (tp == NULL) || (!normalize(text, &first, &last)))
+                return STATUS_BAD_ARGUMENTS;
+            if (nLimit == 0)
+                return STATUS_OK;
+
+            // Update the existing item
+            size_t hash;
+            item_t *item    = find(f, text, first, last, &hash);
+            if (item != NULL)
+            {
+                item->sParams   = *tp;
+                return STATUS_OK;
+            }
+
+            // Allocate hash bins
+            if (vBins == NULL)
+            {
+                vBins           = static_cast<item_t **>(::calloc(BINS, sizeof(item_t *)));
+                if (vBins == NULL)
+                    return STATUS_NO_MEM;
+            }
+
+            // Allocate the item, the text and the font name are stored right after the item
+            const char *name= f->get_name();
+            if (name == NULL)
+                name            = "";
+            size_t nlen     = ::strlen(name);
+            size_t tlen     = last - first;
+            size_t hdr      = align_size(sizeof(item_t), sizeof(lsp_wchar_t));
+            item            = static_cast<item_t *>(::malloc(hdr + tlen * sizeof(lsp_wchar_t) + nlen));
+            if (item == NULL)
+                return STATUS_NO_MEM;
+
+            uint8_t *ptr    = reinterpret_cast<uint8_t *>(item);
+            item->pPrev     = NULL;
+            item->pNext     = NULL;
+            item->nHash     = hash;
+            item->fSize     = f->get_size();
+            item->nFlags    = f->flags();
+            item->nName     = nlen;
+            item->nText     = tlen;
+            item->vText     = reinterpret_cast<lsp_wchar_t *>(&ptr[hdr]);
+            item->sName     = reinterpret_cast<char *>(&ptr[hdr + tlen * sizeof(lsp_wchar_t)]);
+            item->sParams   = *tp;
+            ::memcpy(item->vText, text->characters() + first, tlen * sizeof(lsp_wchar_t));
+            ::memcpy(item->sName, name, nlen);
+
+            // Free space and link the item
+            evict(nLimit - 1);
+
+            item_t **bin    = &vBins[hash & (BINS - 1)];
+            item->pBinNext  = *bin;
+            *bin            = item;
+            link_first(item);
+            ++nItems;
+
+            return STATUS_OK;
+        }
+
+        bool TextCache::measure(ws::ISurface *s, const ws::Font *f, ws::text_parameters_t *tp, const LSPString *text, ssize_t first, ssize_t last)
+        {
+            if ((s == NULL) || (text == NULL))
+                return false;
+            if (get(f, tp, text, first, last))
+                return true;
+            if (!s->get_text_parameters(*f, tp, text, first, last))
+                return false;
+
+            put(f, tp, text, first, last);
+            return true;
+        }
+
+        void TextCache::flush()
+        {
+            for (item_t *it = pHead; it != NULL; )
+            {
+                item_t *next    = it->pNext;
+                ::free(it);
+                it              = next;
+            }
+
+            if (vBins != NULL)
+            {
+                ::free(vBins);
+                vBins           = NULL;
+            }
+
+            pHead           = NULL;
+            pTail           = NULL;
+            nItems          = 0;
+        }
+
+        void TextCache::set_limit(size_t limit)
+        {
+            nLimit          = limit;
+            evict(nLimit);
+        }
+
+        void TextCache::reset_stats()
+        {
+            nHits           = 0;
+            nMisses         = 0;
+        }
+    }
+}
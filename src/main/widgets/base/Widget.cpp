@@ -89,6 +89,9 @@ namespace lsp
             sSize.nWidth            = 0;
             sSize.nHeight           = 0;
             pSurface                = NULL;
+            nSurfaceStamp           = 0;
+            pSurfPrev               = NULL;
+            pSurfNext               = NULL;
         }
 
         Widget::~Widget()
@@ -181,12 +184,7 @@ namespace lsp
             set_parent(NULL);
 
             // Destroy surface
-            if (pSurface != NULL)
-            {
-                pSurface->destroy();
-                delete pSurface;
-                pSurface = NULL;
-            }
+            drop_surface();
 
             // Execute slots and unbind all to prevent duplicate on_destroy calls
             sSlots.execute(SLOT_DESTROY, this);
@@ -463,12 +461,7 @@ namespace lsp
                 wnd->discard_widget(this);
 
             // Drop surface to not to eat memory
-            if (pSurface != NULL)
-            {
-                pSurface->destroy();
-                delete pSurface;
-                pSurface = NULL;
-            }
+            drop_surface();
 
             // Execute slot
             sSlots.execute(SLOT_HIDE, this);
@@ -527,6 +520,14 @@ namespace lsp
             if (flags == nFlags)
                 return;
 
+            // Report damaged area to the top-level window
+            if ((flags ^ nFlags) & REDRAW_SURFACE)
+            {
+                Window *wnd     = widget_cast<Window>(toplevel());
+                if (wnd != NULL)
+                    wnd->damage_widget(this);
+            }
+
             // Update flags and call parent
             nFlags      = flags;
             if (pParent != NULL)
@@ -592,15 +593,16 @@ namespace lsp
             if (pSurface != NULL)
             {
                 if ((width != ssize_t(pSurface->width())) || (height != ssize_t(pSurface->height())))
-                {
-                    pSurface->destroy();
-                    delete pSurface;
-                    pSurface    = NULL;
-                }
+                    drop_surface();
             }
 
-            // Create new surface if needed
-            if (pSurface == NULL)
+            // Mark surface as recently used
+            nSurfaceStamp   = pDisplay->frame_stamp();
+
+            // Move the surface to the tail of the LRU list or create new surface if needed
+            if (pSurface != NULL)
+                pDisplay->touch_surface(this);
+            else
             {
                 if (s == NULL)
                     return NULL;
@@ -609,9 +611,10 @@ namespace lsp
                 if ((width <= 0) || (height <= 0))
                     return NULL;
 
-                pSurface        = s->create(width, height);
+                pSurface        = pDisplay->alloc_surface(this, s, width, height);
                 if (pSurface == NULL)
                     return NULL;
+                surface_created(pSurface);
                 nFlags         |= REDRAW_SURFACE;
             }
 
@@ -625,6 +628,20 @@ namespace lsp
             return pSurface;
         }
 
+        void Widget::drop_surface()
+        {
+            if (pSurface == NULL)
+                return;
+
+            ws::ISurface *s = pSurface;
+            pSurface        = NULL;
+            pDisplay->release_surface(this, s);
+        }
+
+        void Widget::surface_created(ws::ISurface *s)
+        {
+        }
+
         void Widget::draw(ws::ISurface *s)
         {
         }
@@ -646,14 +663,20 @@ namespace lsp
 
         void Widget::realize_widget(const ws::rectangle_t *r)
         {
-            nFlags     |= REALIZE_ACTIVE;
+            // The parent may just move the widget without changing it's size, in this
+            // case the widget does not need to be redrawn, the parent is responsible for it
+            bool move   = (pParent != NULL) && (pParent->nFlags & REALIZE_MOVE) &&
+                          (sSize.nWidth == r->nWidth) && (sSize.nHeight == r->nHeight);
+
+            nFlags     |= (move) ? REALIZE_ACTIVE | REALIZE_MOVE : REALIZE_ACTIVE;
 
             // Call for realize
             realize(r);
 
             // Reset size pending flags
-            nFlags     &= ~(SIZE_INVALID | RESIZE_PENDING | REALIZE_ACTIVE);
-            query_draw();   // Always query redraw after realize()
+            nFlags     &= ~(SIZE_INVALID | RESIZE_PENDING | REALIZE_ACTIVE | REALIZE_MOVE);
+            if (!move)
+                query_draw();   // Always query redraw after realize()
 
             // Send Realized() event
             ws::rectangle_t rm = *r;
@@ -66,12 +66,28 @@ namespace lsp
             LSP_TK_BUILTIN_STYLE(ListBox, "ListBox");
         }
 
+        IListBoxModel::~IListBoxModel()
+        {
+        }
+
+        size_t IListBoxModel::size()
+        {
+            return 0;
+        }
+
+        status_t IListBoxModel::format(LSPString *dst, size_t index)
+        {
+            dst->clear();
+            return STATUS_OK;
+        }
+
         const w_class_t ListBox::metadata               = { "ListBox", &WidgetContainer::metadata };
 
         ListBox::ListBox(Display *dpy):
             WidgetContainer(dpy),
             sHBar(dpy),
             sVBar(dpy),
+            sRow(dpy),
             vItems(&sProperties, &sIListener),
             vSelected(&sProperties, &sIListener),
             sSizeConstraints(&sProperties),
@@ -95,6 +111,11 @@ namespace lsp
             nCurrIndex      = -1;
             nLastIndex      = -1;
             nKeyScroll      = SCR_NONE;
+            nTextSerial     = 1;
+
+            pModel          = NULL;
+            nRowHeight      = 0;
+            nRowWidth       = 0;
 
             sArea.nLeft     = 0;
             sArea.nTop      = 0;
@@ -138,13 +159,17 @@ namespace lsp
             vItems.flush();
             vSelected.flush();
             vVisible.flush();
+            vRowSelected.flush();
+            pModel              = NULL;
 
             // Cleanup relations
             sHBar.set_parent(NULL);
             sVBar.set_parent(NULL);
+            sRow.set_parent(NULL);
 
             sHBar.destroy();
             sVBar.destroy();
+            sRow.destroy();
         }
 
         status_t ListBox::init()
@@ -157,6 +182,8 @@ namespace lsp
                 result  = sHBar.init();
             if (result == STATUS_OK)
                 result  = sVBar.init();
+            if (result == STATUS_OK)
+                result  = sRow.init();
             if (result != STATUS_OK)
                 return result;
 
@@ -181,6 +208,8 @@ namespace lsp
             sVBar.slots()->bind(SLOT_KEY_DOWN, slot_on_scroll_key_down, self());
             sVBar.slots()->bind(SLOT_KEY_UP, slot_on_scroll_key_up, self());
 
+            sRow.set_parent(this);
+
             // Init style
             sSizeConstraints.bind("size.constraints", &sStyle);
             sHScrollMode.bind("hscroll.mode", &sStyle);
@@ -221,8 +250,13 @@ namespace lsp
                 sHBar.value()->set(sHScroll.get());
             if (sVScroll.is(prop))
                 sVBar.value()->set(sVScroll.get());
-            if (sFont.is(prop))
+            if ((sFont.is(prop)) || (sScaling.is(prop)))
+            {
+                // Invalidate cached text sizes
+                ++nTextSerial;
+                nRowWidth       = 0;
                 query_resize();
+            }
             if (sBorderSize.is(prop))
                 query_resize();
             if (sBorderRadius.is(prop))
@@ -260,6 +294,23 @@ namespace lsp
             ws::text_parameters_t tp;
             sFont.get_parameters(pDisplay, scaling, &fp);
 
+            // In the virtual mode all rows have the same height, the width is estimated
+            // only for rows that have been realized at least once
+            if (pModel != NULL)
+            {
+                ws::rectangle_t xr;
+                xr.nLeft        = 0;
+                xr.nTop         = 0;
+                xr.nWidth       = 0;
+                xr.nHeight      = fp.Height;
+                sRow.padding()->add(&xr, scaling);
+
+                nRowHeight      = xr.nHeight;
+                alloc->wMinW    = lsp_max(nRowWidth, xr.nWidth);
+                alloc->wMinH    = (nRowHeight + spacing) * pModel->size();
+                return;
+            }
+
             for (size_t i=0, n=vItems.size(); i<n; ++i)
             {
                 // Skip invisible items
@@ -274,16 +325,24 @@ namespace lsp
                 ai->item        = li;
                 ai->index       = i;
 
-                // Obtain the text of item and it's parameters
-                s.clear();
-                li->text()->format(&s);
-                sFont.get_text_parameters(pDisplay, &tp, scaling, &s);
+                // Obtain the text of item and it's parameters, measure only items
+                // which have been changed since the last measurement
+                if (li->nTextSerial != nTextSerial)
+                {
+                    s.clear();
+                    li->text()->format(&s);
+                    sFont.get_text_parameters(pDisplay, &tp, scaling, &s);
+
+                    li->nTextWidth  = tp.Width;
+                    li->nTextHeight = tp.Height;
+                    li->nTextSerial = nTextSerial;
+                }
 
                 // Estimate size
                 ai->a.nLeft     = 0;
                 ai->a.nTop      = 0;
-                ai->a.nWidth    = tp.Width;
-                ai->a.nHeight   = lsp_max(tp.Height, fp.Height);
+                ai->a.nWidth    = li->nTextWidth;
+                ai->a.nHeight   = lsp_max(li->nTextHeight, ssize_t(fp.Height));
 
                 ai->r.nLeft     = 0;
                 ai->r.nTop      = 0;
@@ -448,8 +507,7 @@ namespace lsp
             realize_children();
 
             // Update scrolling
-            item_t *curr    = find_by_index(nCurrIndex);
-            ssize_t start   = vVisible.index_of(curr);
+            ssize_t start   = visible_index(nCurrIndex);
             if (start >= 0)
             {
                 if (scroll_to_item(start))
@@ -462,6 +520,12 @@ namespace lsp
 
         void ListBox::realize_children()
         {
+            if (pModel != NULL)
+            {
+                realize_rows();
+                return;
+            }
+
             float scaling       = lsp_max(0.0f, sScaling.get());
             ssize_t spacing     = lsp_max(0.0f, scaling * sSpacing.get());
             ssize_t max_w       = sList.nWidth;
@@ -479,7 +543,7 @@ namespace lsp
                 max_w       = lsp_max(max_w, it->a.nWidth);
             }
 
-            // Realize widgets
+            // Compute the location of all items but realize only items that are visible
             for (size_t i=0, n=vVisible.size(); i<n; ++i)
             {
                 item_t *it  = vVisible.uget(i);
@@ -489,7 +553,8 @@ namespace lsp
                 it->r.nLeft         = xr.nLeft;
                 it->r.nTop          = xr.nTop + (spacing >> 1);
 
-                it->item->realize_widget(&it->r);
+                if (Size::overlap(&sList, &it->r))
+                    it->item->realize_widget(&it->r);
 
                 // Update position
                 xr.nTop            += it->a.nHeight + spacing;
@@ -499,6 +564,58 @@ namespace lsp
             query_draw();
         }
 
+        void ListBox::realize_rows()
+        {
+            float scaling       = lsp_max(0.0f, sScaling.get());
+            ssize_t spacing     = lsp_max(0.0f, scaling * sSpacing.get());
+            ssize_t step        = nRowHeight + spacing;
+            ssize_t count       = pModel->size();
+            ssize_t voff        = (sVBar.visibility()->get()) ? sVBar.value()->get() : 0;
+            if ((step <= 0) || (count <= 0))
+            {
+                query_draw();
+                return;
+            }
+
+            // Measure the width of visible rows
+            ssize_t first       = lsp_max(0, voff / step);
+            ssize_t last        = lsp_min(count, (voff + sList.nHeight + step - 1) / step);
+            ssize_t max_w       = nRowWidth;
+
+            LSPString s;
+            ws::text_parameters_t tp;
+            ws::rectangle_t xr;
+
+            for (ssize_t i=first; i<last; ++i)
+            {
+                s.clear();
+                if (pModel->format(&s, i) != STATUS_OK)
+                    continue;
+                sFont.get_text_parameters(pDisplay, &tp, scaling, &s);
+
+                xr.nLeft        = 0;
+                xr.nTop         = 0;
+                xr.nWidth       = tp.Width;
+                xr.nHeight      = 0;
+                sRow.padding()->add(&xr, scaling);
+                max_w           = lsp_max(max_w, xr.nWidth);
+            }
+
+            // Update the horizontal scrolling range if some row became wider. Resize
+            // requests are ignored while realizing, so defer it until realize completes
+            if (max_w > nRowWidth)
+            {
+                nRowWidth           = max_w;
+                if (nFlags & REALIZE_ACTIVE)
+                    nXFlags            |= F_ROWS_RESIZE;
+                else
+                    query_resize();
+            }
+
+            // Mark for redraw
+            query_draw();
+        }
+
         void ListBox::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
         {
             if (nFlags & REDRAW_SURFACE)
@@ -607,10 +724,12 @@ namespace lsp
                     // Perform rendering of list
                     LSPString text;
                     ws::font_parameters_t fp;
-                    ws::text_parameters_t tp;
                     sFont.get_parameters(pDisplay, scaling, &fp);
 
                     s->clip_begin(&xa);
+                    if (pModel != NULL)
+                        render_rows(s, &xa, scaling);
+
                     for (size_t i=0, n=vVisible.size(); i<n; ++i)
                     {
                         item_t *it = vVisible.get(i);
@@ -627,7 +746,6 @@ namespace lsp
                         text.clear();
                         li->text()->format(&text);
                         bool selected = vSelected.contains(li);
-                        sFont.get_text_parameters(pDisplay, &tp, scaling, &text);
 
                         if (selected)
                         {
@@ -653,8 +771,70 @@ namespace lsp
             }
         }
 
+        void ListBox::render_rows(ws::ISurface *s, const ws::rectangle_t *area, float scaling)
+        {
+            sRow.commit_redraw();
+
+            ssize_t spacing     = lsp_max(0.0f, scaling * sSpacing.get());
+            ssize_t step        = nRowHeight + spacing;
+            ssize_t count       = pModel->size();
+            ssize_t voff        = (sVBar.visibility()->get()) ? sVBar.value()->get() : 0;
+            if ((step <= 0) || (count <= 0))
+                return;
+
+            // Compute the range of rows that intersect the area
+            ssize_t top         = area->nTop - sList.nTop + voff;
+            ssize_t first       = lsp_max(0, top / step);
+            ssize_t last        = lsp_min(count, (top + area->nHeight + step - 1) / step);
+
+            LSPString text;
+            ws::font_parameters_t fp;
+            ws::rectangle_t r, xr;
+            lsp::Color col;
+            sFont.get_parameters(pDisplay, scaling, &fp);
+
+            for (ssize_t i=first; i<last; ++i)
+            {
+                if (!visible_rect(&r, i))
+                    continue;
+
+                text.clear();
+                if (pModel->format(&text, i) != STATUS_OK)
+                    continue;
+
+                if (row_selected(i))
+                {
+                    col.copy(sRow.bg_selected_color()->color());
+                    s->fill_rect(col, &r);
+                    col.copy(sRow.text_selected_color()->color());
+                }
+                else
+                {
+                    col.copy(sRow.bg_color()->color());
+                    s->fill_rect(col, &r);
+                    col.copy(sRow.text_color()->color());
+                }
+
+                sRow.padding()->enter(&xr, &r, scaling);
+                sFont.draw(s, col,
+                        xr.nLeft,
+                        xr.nTop  + ((xr.nHeight - fp.Height) * 0.5f) + fp.Ascent,
+                        scaling, &text);
+            }
+        }
+
         void ListBox::keep_single_selection()
         {
+            if (vRowSelected.size() > 1)
+            {
+                size_t index    = *(vRowSelected.last());
+                vRowSelected.clear();
+                size_t *dst     = vRowSelected.add();
+                if (dst != NULL)
+                    *dst            = index;
+                query_draw();
+            }
+
             lltl::parray<ListBoxItem> si;
             if (!vSelected.values(&si))
                 return;
@@ -773,6 +953,18 @@ namespace lsp
             _this->unlink_widget(item);
         }
 
+        status_t ListBox::on_realized(const ws::rectangle_t *r)
+        {
+            // Issue the resize request deferred by realize_rows()
+            if (nXFlags & F_ROWS_RESIZE)
+            {
+                nXFlags    &= ~F_ROWS_RESIZE;
+                query_resize();
+            }
+
+            return WidgetContainer::on_realized(r);
+        }
+
         status_t ListBox::on_mouse_down(const ws::event_t *e)
         {
             if (nBMask == 0)
@@ -812,10 +1004,10 @@ namespace lsp
             if (nBMask != ws::MCF_LEFT)
                 return STATUS_OK;
 
-            item_t *it  = find_item(e->nLeft, e->nTop);
-            if (it != NULL)
+            ssize_t index   = find_row(e->nLeft, e->nTop);
+            if (index >= 0)
             {
-                nCurrIndex      = it->index;
+                nCurrIndex      = index;
                 if (e->nState & ws::MCF_SHIFT)
                     select_range(nLastIndex, nCurrIndex, e->nState & ws::MCF_CONTROL);
                 else
@@ -946,20 +1138,37 @@ namespace lsp
             if (!add)
             {
                 vSelected.clear();
+                vRowSelected.clear();
                 changed = true;
             }
 
             if (last < first)
                 swap(first, last);
 
-            for (; first <= last; ++first)
+            if (pModel != NULL)
             {
-                ListBoxItem *li = vItems.get(first);
-                if ((li == NULL) || (!li->visibility()->get()))
-                    continue;
+                // In the virtual mode the range is limited by the rows of the model
+                first       = lsp_max(first, 0);
+                last        = lsp_min(last, ssize_t(pModel->size()) - 1);
+                for (; first <= last; ++first)
+                {
+                    if (row_selected(first))
+                        continue;
+                    select_row(first, true);
+                    changed = true;
+                }
+            }
+            else
+            {
+                for (; first <= last; ++first)
+                {
+                    ListBoxItem *li = vItems.get(first);
+                    if ((li == NULL) || (!li->visibility()->get()))
+                        continue;
 
-                vSelected.add(li);
-                changed = true;
+                    vSelected.add(li);
+                    changed = true;
+                }
             }
 
             // Execute change
@@ -976,13 +1185,34 @@ namespace lsp
             if ((!add) || (!sMultiSelect.get()))
             {
                 vSelected.clear();
+                vRowSelected.clear();
                 changed = true;
             }
-            ListBoxItem *it = vItems.get(index);
-            if (it != NULL)
+
+            if (pModel != NULL)
             {
-                vSelected.toggle(it);
-                changed = true;
+                if ((index >= 0) && (index < ssize_t(pModel->size())))
+                {
+                    ssize_t pos     = row_index(index);
+                    if ((pos < ssize_t(vRowSelected.size())) && (*(vRowSelected.uget(pos)) == size_t(index)))
+                        vRowSelected.remove(pos);
+                    else
+                    {
+                        size_t *dst     = vRowSelected.insert(pos);
+                        if (dst != NULL)
+                            *dst            = index;
+                    }
+                    changed = true;
+                }
+            }
+            else
+            {
+                ListBoxItem *it = vItems.get(index);
+                if (it != NULL)
+                {
+                    vSelected.toggle(it);
+                    changed = true;
+                }
             }
 
             // Execute change
@@ -1021,12 +1251,11 @@ namespace lsp
                 case ws::WSK_HOME:
                 case ws::WSK_KEYPAD_HOME:
                 {
-                    item_t *it  = vVisible.first();
-                    if (it != NULL)
+                    if (visible_count() > 0)
                     {
-                        nCurrIndex  = it->index;
+                        nCurrIndex  = item_index(0);
                         select_single(nCurrIndex, false);
-                        scroll_to_item(vVisible.index_of(it));
+                        scroll_to_item(0);
                     }
                     break;
                 }
@@ -1034,12 +1263,12 @@ namespace lsp
                 case ws::WSK_END:
                 case ws::WSK_KEYPAD_END:
                 {
-                    item_t *it  = vVisible.last();
-                    if (it != NULL)
+                    ssize_t vindex  = visible_count() - 1;
+                    if (vindex >= 0)
                     {
-                        nCurrIndex  = it->index;
+                        nCurrIndex  = item_index(vindex);
                         select_single(nCurrIndex, false);
-                        scroll_to_item(vVisible.index_of(it));
+                        scroll_to_item(vindex);
                     }
                     break;
                 }
@@ -1110,23 +1339,25 @@ namespace lsp
                 return STATUS_OK;
 
             float scaling   = lsp_max(0.0f, sScaling.get());
-            item_t *curr    = find_by_index(nCurrIndex);
-            ssize_t start   = lsp_max(-1, vVisible.index_of(curr));
-            ssize_t last    = vVisible.size() - 1;
+            ssize_t start   = lsp_max(-1, visible_index(nCurrIndex));
+            ssize_t last    = visible_count() - 1;
             ssize_t vindex  = start;
+            ws::rectangle_t r;
 
             // Vertical scrolling
             if (mask & (SCR_PGUP | SCR_KP_PGUP))
             {
-                ssize_t amount  = sList.nHeight - curr->r.nHeight;
+                ssize_t amount  = sList.nHeight;
+                if (visible_rect(&r, vindex))
+                    amount         -= r.nHeight;
 
                 // Perform PG_UP and PG_DOWN scroll
                 if (nKeyScroll & (SCR_PGUP | SCR_KP_PGUP))
                 {
                     while (vindex > 0)
                     {
-                        curr        = vVisible.get(--vindex);
-                        amount     -= curr->r.nHeight;
+                        visible_rect(&r, --vindex);
+                        amount     -= r.nHeight;
                         if (amount <= 0)
                             break;
                     }
@@ -1135,8 +1366,8 @@ namespace lsp
                 {
                     while (vindex < last)
                     {
-                        curr        = vVisible.get(++vindex);
-                        amount     -= curr->r.nHeight;
+                        visible_rect(&r, ++vindex);
+                        amount     -= r.nHeight;
                         if (amount <= 0)
                             break;
                     }
@@ -1158,8 +1389,7 @@ namespace lsp
 
             if (vindex != start)
             {
-                curr        = vVisible.uget(vindex);
-                nCurrIndex  = curr->index;
+                nCurrIndex  = item_index(vindex);
                 select_single(nCurrIndex, false);
                 scroll_to_item(vindex);
             }
@@ -1182,18 +1412,18 @@ namespace lsp
             if (!sVBar.visibility()->get())
                 return false;
 
-            item_t *curr    = vVisible.get(vindex);
-            if (curr == NULL)
+            ws::rectangle_t r;
+            if (!visible_rect(&r, vindex))
                 return false;
 
-            if (curr->r.nTop < sList.nTop)
+            if (r.nTop < sList.nTop)
             {
-                sVBar.value()->sub(sList.nTop - curr->r.nTop);
+                sVBar.value()->sub(sList.nTop - r.nTop);
                 realize_children();
             }
-            else if ((curr->r.nTop + curr->r.nHeight) > (sList.nTop + sList.nHeight))
+            else if ((r.nTop + r.nHeight) > (sList.nTop + sList.nHeight))
             {
-                sVBar.value()->add(curr->r.nTop + curr->r.nHeight - sList.nTop - sList.nHeight);
+                sVBar.value()->add(r.nTop + r.nHeight - sList.nTop - sList.nHeight);
                 realize_children();
             }
             else
@@ -1202,6 +1432,162 @@ namespace lsp
             return true;
         }
 
+        size_t ListBox::visible_count()
+        {
+            return (pModel != NULL) ? pModel->size() : vVisible.size();
+        }
+
+        ssize_t ListBox::visible_index(ssize_t index)
+        {
+            if (pModel != NULL)
+                return ((index >= 0) && (index < ssize_t(pModel->size()))) ? index : -1;
+
+            item_t *it      = find_by_index(index);
+            return (it != NULL) ? vVisible.index_of(it) : -1;
+        }
+
+        ssize_t ListBox::item_index(ssize_t vindex)
+        {
+            if (pModel != NULL)
+                return ((vindex >= 0) && (vindex < ssize_t(pModel->size()))) ? vindex : -1;
+
+            item_t *it      = vVisible.get(vindex);
+            return (it != NULL) ? it->index : -1;
+        }
+
+        bool ListBox::visible_rect(ws::rectangle_t *r, ssize_t vindex)
+        {
+            if (pModel == NULL)
+            {
+                item_t *it      = vVisible.get(vindex);
+                if (it == NULL)
+                    return false;
+                *r              = it->r;
+                return true;
+            }
+
+            if ((vindex < 0) || (vindex >= ssize_t(pModel->size())))
+                return false;
+
+            float scaling       = lsp_max(0.0f, sScaling.get());
+            ssize_t spacing     = lsp_max(0.0f, scaling * sSpacing.get());
+
+            r->nLeft            = sList.nLeft;
+            r->nTop             = sList.nTop + (nRowHeight + spacing) * vindex + (spacing >> 1);
+            r->nWidth           = lsp_max(sList.nWidth, nRowWidth);
+            r->nHeight          = nRowHeight;
+
+            if (sHBar.visibility()->get())
+                r->nLeft           -= sHBar.value()->get();
+            if (sVBar.visibility()->get())
+                r->nTop            -= sVBar.value()->get();
+
+            return true;
+        }
+
+        ssize_t ListBox::find_row(ssize_t x, ssize_t y)
+        {
+            if (pModel == NULL)
+            {
+                item_t *it      = find_item(x, y);
+                return (it != NULL) ? it->index : -1;
+            }
+
+            float scaling       = lsp_max(0.0f, sScaling.get());
+            ssize_t spacing     = lsp_max(0.0f, scaling * sSpacing.get());
+            ssize_t step        = nRowHeight + spacing;
+            if ((step <= 0) || (!Position::inside(&sList, x, y)))
+                return -1;
+
+            ssize_t top         = y - sList.nTop;
+            if (sVBar.visibility()->get())
+                top                += sVBar.value()->get();
+            if (top < 0)
+                return -1;
+
+            ws::rectangle_t r;
+            ssize_t index       = top / step;
+            if (!visible_rect(&r, index))
+                return -1;
+
+            return (Position::inside(&r, x, y)) ? index : -1;
+        }
+
+        ssize_t ListBox::row_index(size_t index)
+        {
+            // Binary search for the position of the row in the sorted selection list
+            ssize_t first = 0, last = vRowSelected.size();
+            const size_t *v = vRowSelected.array();
+
+            while (first < last)
+            {
+                ssize_t middle  = (first + last) >> 1;
+                if (v[middle] < index)
+                    first           = middle + 1;
+                else
+                    last            = middle;
+            }
+
+            return first;
+        }
+
+        void ListBox::set_model(IListBoxModel *model)
+        {
+            if (pModel == model)
+                return;
+
+            pModel          = model;
+            nCurrIndex      = -1;
+            nLastIndex      = -1;
+            nRowWidth       = 0;
+            vRowSelected.clear();
+            query_resize();
+        }
+
+        void ListBox::model_changed()
+        {
+            if (pModel == NULL)
+                return;
+
+            // Drop selection of rows that do not exist anymore
+            ssize_t pos     = row_index(pModel->size());
+            while (ssize_t(vRowSelected.size()) > pos)
+                vRowSelected.remove(vRowSelected.size() - 1);
+            if (nCurrIndex >= ssize_t(pModel->size()))
+                nCurrIndex      = -1;
+
+            nRowWidth       = 0;
+            query_resize();
+        }
+
+        bool ListBox::row_selected(size_t index)
+        {
+            ssize_t pos     = row_index(index);
+            return (pos < ssize_t(vRowSelected.size())) && (*(vRowSelected.uget(pos)) == index);
+        }
+
+        void ListBox::select_row(size_t index, bool add)
+        {
+            if ((!add) || (!sMultiSelect.get()))
+                vRowSelected.clear();
+
+            ssize_t pos     = row_index(index);
+            if ((pos >= ssize_t(vRowSelected.size())) || (*(vRowSelected.uget(pos)) != index))
+            {
+                size_t *dst     = vRowSelected.insert(pos);
+                if (dst != NULL)
+                    *dst            = index;
+            }
+
+            query_draw();
+        }
+
+        void ListBox::clear_rows()
+        {
+            vRowSelected.clear();
+            query_draw();
+        }
+
         status_t ListBox::on_change()
         {
             return STATUS_OK;
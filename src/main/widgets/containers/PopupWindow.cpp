@@ -111,10 +111,6 @@ namespace lsp
 
         status_t PopupWindow::post_init()
         {
-            // Bind redraw handler
-            sRedraw.bind(pDisplay->display());
-            sRedraw.set_handler(tmr_redraw_request, self());
-
             // Don't create native window
             return STATUS_OK;
         }
@@ -154,11 +150,10 @@ namespace lsp
 
             Window::hide_widget();
 
-            // Destroy window
+            // Return window to the pool of idle windows
             if (pWindow != NULL)
             {
-                pWindow->destroy();
-                delete pWindow;
+                pDisplay->release_window(pWindow);
                 pWindow = NULL;
             }
         }
@@ -195,32 +190,21 @@ namespace lsp
             if ((screen < 0) || (screen >= ssize_t(dpy->screens())))
                 screen      = dpy->default_screen();
 
-            // Destroy the window if it does not match requirements
+            // Release the window if it does not match requirements
             if ((pWindow != NULL) && (pWindow->screen() != size_t(screen)))
             {
-                pWindow->destroy();
-                delete pWindow;
+                pDisplay->release_window(pWindow);
                 pWindow = NULL;
             }
 
-            // Now we are ready to create window
+            // Now we are ready to take the window from the pool or create it
             ws::IWindow *wnd = pWindow;
             if (wnd == NULL)
             {
-                // Create window
-                wnd = dpy->create_window(screen);
+                wnd = pDisplay->acquire_window(screen);
                 if (wnd == NULL)
                     return false;
 
-                // Initialize window
-                status_t result = wnd->init();
-                if (result != STATUS_OK)
-                {
-                    wnd->destroy();
-                    delete wnd;
-                    return false;
-                }
-
                 wnd->set_handler(this);
                 wnd->set_border_style(sBorderStyle.get());
                 wnd->set_window_actions(sActions.get_all());
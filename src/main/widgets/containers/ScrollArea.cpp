@@ -68,6 +68,14 @@ namespace lsp
             sArea.nWidth    = 0;
             sArea.nHeight   = 0;
 
+            pScrollBuf          = NULL;
+            sViewport.nLeft     = 0;
+            sViewport.nTop      = 0;
+            sViewport.nWidth    = 0;
+            sViewport.nHeight   = 0;
+            sRendered           = sViewport;
+            bRendered           = false;
+
             pClass      = &metadata;
         }
         
@@ -135,6 +143,19 @@ namespace lsp
                 unlink_widget(pWidget);
                 pWidget = NULL;
             }
+
+            drop_scroll_buffer();
+        }
+
+        void ScrollArea::drop_scroll_buffer()
+        {
+            if (pScrollBuf != NULL)
+            {
+                pScrollBuf->destroy();
+                delete pScrollBuf;
+                pScrollBuf  = NULL;
+            }
+            bRendered   = false;
         }
 
         void ScrollArea::property_changed(Property *prop)
@@ -330,7 +351,7 @@ namespace lsp
 
             lsp::Color col(sBgColor);
 
-            ws::rectangle_t h, v, xa, xr;
+            ws::rectangle_t h, v, xa;
             xa  = sSize;
 
             // Render scroll bars
@@ -381,18 +402,46 @@ namespace lsp
                 s->clip_begin(area);
                     s->fill_rect(col, &xa);
                 s->clip_end();
+                bRendered   = false;
                 return;
             }
 
-            // Draw the rest part of widget
+            // Draw the rest part of widget, the child is rendered only within the visible viewport
+            ws::rectangle_t vp = xa;
             if (!Size::intersection(&xa, area))
                 return;
 
+            // Try to scroll the previously rendered contents instead of full redraw.
+            // Moved children do not query for redraw, so the fully redrawn viewport
+            // should be reported to the window as damaged
+            if ((!force) && (!scroll_viewport(s, &vp)))
+            {
+                force   = true;
+                Window *wnd = widget_cast<Window>(toplevel());
+                if (wnd != NULL)
+                    wnd->damage_area(&vp);
+            }
+
+            render_child(s, &xa, force);
+
+            // Remember the state of viewport if it has been fully redrawn
+            if (force)
+            {
+                bRendered   = Size::contains(area, &vp);
+                sViewport   = vp;
+                pWidget->get_rectangle(&sRendered);
+            }
+        }
+
+        void ScrollArea::render_child(ws::ISurface *s, const ws::rectangle_t *area, bool force)
+        {
+            ws::rectangle_t xr, cr;
+            pWidget->get_rectangle(&cr);
+
             if ((force) || (pWidget->redraw_pending()))
             {
                 // Draw the child only if it is visible in the area
-                pWidget->get_rectangle(&xr);
-                if (Size::intersection(&xr, &xa))
+                if (Size::intersection(&xr, &cr, area))
                     pWidget->render(s, &xr, force);
 
                 pWidget->commit_redraw();
@@ -400,19 +449,86 @@ namespace lsp
 
             if (force)
             {
-                pWidget->get_rectangle(&xr);
-                if ((Size::is_empty(&xr)) || (Size::overlap(&xr, &xa)))
+                if ((Size::is_empty(&cr)) || (Size::overlap(&cr, area)))
                 {
-                    s->clip_begin(&xa);
-                    {
-                        col.copy(pWidget->bg_color()->color());
-                        s->fill_frame(col, &xa, &xr);
-                    }
+                    lsp::Color col(pWidget->bg_color()->color());
+                    s->clip_begin(area);
+                        s->fill_frame(col, area, &cr);
                     s->clip_end();
                 }
             }
         }
 
+        bool ScrollArea::scroll_viewport(ws::ISurface *s, const ws::rectangle_t *vp)
+        {
+            ws::rectangle_t xr;
+            pWidget->get_rectangle(&xr);
+
+            // Nothing to scroll if the child widget has not been moved
+            ssize_t dx  = xr.nLeft - sRendered.nLeft;
+            ssize_t dy  = xr.nTop  - sRendered.nTop;
+            if ((dx == 0) && (dy == 0))
+                return true;
+            ssize_t adx = (dx < 0) ? -dx : dx;
+            ssize_t ady = (dy < 0) ? -dy : dy;
+
+            // The contents can be scrolled only if the geometry has not been changed
+            // and the previous contents of the viewport are valid
+            if ((!bRendered) ||
+                (xr.nWidth != sRendered.nWidth) || (xr.nHeight != sRendered.nHeight) ||
+                (vp->nLeft != sViewport.nLeft) || (vp->nTop != sViewport.nTop) ||
+                (vp->nWidth != sViewport.nWidth) || (vp->nHeight != sViewport.nHeight))
+                return false;
+            if ((adx >= vp->nWidth) || (ady >= vp->nHeight))
+                return false;
+
+            // Prepare the buffer
+            if ((pScrollBuf != NULL) &&
+                ((ssize_t(pScrollBuf->width()) != vp->nWidth) || (ssize_t(pScrollBuf->height()) != vp->nHeight)))
+                drop_scroll_buffer();
+            if (pScrollBuf == NULL)
+            {
+                if ((pScrollBuf = s->create(vp->nWidth, vp->nHeight)) == NULL)
+                    return false;
+            }
+
+            // Blit the contents of the viewport with the offset
+            pScrollBuf->draw(s, -vp->nLeft, -vp->nTop);
+            s->clip_begin(vp);
+                s->draw(pScrollBuf, vp->nLeft + dx, vp->nTop + dy);
+            s->clip_end();
+            sRendered   = xr;
+
+            // Render widgets that have been changed
+            render_child(s, vp, false);
+
+            // Expose the newly visible strips
+            ws::rectangle_t r;
+            if (dy != 0)
+            {
+                r.nLeft     = vp->nLeft;
+                r.nWidth    = vp->nWidth;
+                r.nHeight   = ady;
+                r.nTop      = (dy > 0) ? vp->nTop : vp->nTop + vp->nHeight - r.nHeight;
+                render_child(s, &r, true);
+            }
+            if (dx != 0)
+            {
+                r.nTop      = vp->nTop;
+                r.nHeight   = vp->nHeight;
+                r.nWidth    = adx;
+                r.nLeft     = (dx > 0) ? vp->nLeft : vp->nLeft + vp->nWidth - r.nWidth;
+                render_child(s, &r, true);
+            }
+
+            // Report the whole viewport as damaged
+            Window *wnd = widget_cast<Window>(toplevel());
+            if (wnd != NULL)
+                wnd->damage_area(vp);
+
+            return true;
+        }
+
         status_t ScrollArea::add(Widget *widget)
         {
             if ((widget == NULL) || (widget == this))
@@ -468,9 +584,12 @@ namespace lsp
             if (_this->sVBar.visibility()->get())
                 xr.nTop    -= _this->sVBar.value()->get();
 
+            // Move the child widget, the viewport contents will be scrolled at the next render
             child->padding()->enter(&xr, child->scaling()->get());
+            _this->nFlags  |= REALIZE_MOVE;
             child->realize_widget(&xr);
-            _this->query_draw();
+            _this->nFlags  &= ~REALIZE_MOVE;
+            _this->query_draw(REDRAW_CHILD);
 
             return STATUS_OK;
         }
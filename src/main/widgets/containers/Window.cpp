@@ -89,6 +89,8 @@ namespace lsp
             bOverridePointer= false;
             fScaling        = 1.0f;
             pActor          = NULL;
+            nPixelsSaved    = 0;
+            nPixelsTotal    = 0;
 
             hMouse.nState   = 0;
             hMouse.nLeft    = 0;
@@ -156,10 +158,6 @@ namespace lsp
             // Set self event handler
             pWindow->set_handler(this);
 
-            // Bind redraw handler
-            sRedraw.bind(dpy);
-            sRedraw.set_handler(tmr_redraw_request, self());
-
             lsp_trace("Window has been initialized");
 
             if (sVisibility.get())
@@ -247,6 +245,9 @@ namespace lsp
                 delete pWindow;
                 pWindow = NULL;
             }
+
+            vDamage.flush();
+            pDisplay->cancel_frame(this);
         }
 
         void Window::destroy()
@@ -256,15 +257,6 @@ namespace lsp
             WidgetContainer::destroy();
         }
 
-        status_t Window::tmr_redraw_request(ws::timestamp_t sched, ws::timestamp_t ts, void *args)
-        {
-            if (args == NULL)
-                return STATUS_BAD_ARGUMENTS;
-
-            Window *_this   = widget_ptrcast<Window>(args);
-            return (_this != NULL) ? _this->do_render() : STATUS_BAD_ARGUMENTS;
-        }
-
         status_t Window::slot_window_close(Widget *sender, void *ptr, void *data)
         {
             if ((ptr == NULL) || (data == NULL))
@@ -276,6 +268,7 @@ namespace lsp
 
         status_t Window::do_render()
         {
+            // Unmapped window will request the frame again when it becomes mapped
             if ((pWindow == NULL) || (!bMapped))
                 return STATUS_OK;
 
@@ -285,32 +278,129 @@ namespace lsp
             if (!redraw_pending())
                 return STATUS_OK;
 
-            // call rendering
+            // call rendering, retry at the next frame if there is no surface yet
             ws::ISurface *s = pWindow->get_surface();
             if (s == NULL)
-                return STATUS_OK;
+                return pDisplay->request_frame(this);
+
+            // The whole window should be redrawn if the surface is invalid or the window is dirty
+            bool force      = (nFlags & REDRAW_SURFACE) ||
+                              (pSurface == NULL) ||
+                              (ssize_t(pSurface->width()) != sSize.nWidth) ||
+                              (ssize_t(pSurface->height()) != sSize.nHeight);
 
-            size_t flags = nFlags;
             ws::ISurface *bs = get_surface(s);
+            if (bs == NULL)
+                return pDisplay->request_frame(this);
 
             ws::rectangle_t xr;
+            xr.nLeft        = 0;
+            xr.nTop         = 0;
+            xr.nWidth       = sSize.nWidth;
+            xr.nHeight      = sSize.nHeight;
+
+            size_t total    = xr.nWidth * xr.nHeight;
+            size_t damaged  = total;
+
             s->begin();
-                xr.nLeft    = 0;
-                xr.nTop     = 0;
-                xr.nWidth   = sSize.nWidth;
-                xr.nHeight  = sSize.nHeight;
-                render(bs, &xr, flags);
+                render(bs, &xr, force);
 
-                s->draw(bs, 0, 0);
+                if (force)
+                    s->draw(bs, 0, 0);
+                else
+                {
+                    // Transfer only damaged areas to the window surface
+                    damaged         = 0;
+                    for (size_t i=0, n=vDamage.size(); i<n; ++i)
+                    {
+                        ws::rectangle_t *r = vDamage.uget(i);
+                        s->clip_begin(r);
+                            s->draw(bs, 0, 0);
+                        s->clip_end();
+                        damaged        += r->nWidth * r->nHeight;
+                    }
+                }
                 commit_redraw();
             s->end();
 
+            // Update statistics
+            vDamage.clear();
+            nPixelsSaved    = (damaged < total) ? total - damaged : 0;
+            nPixelsTotal   += nPixelsSaved;
+
             // And also update pointer
             update_pointer();
 
             return STATUS_OK;
         }
 
+        void Window::query_draw(size_t flags)
+        {
+            WidgetContainer::query_draw(flags);
+            if ((bMapped) && (redraw_pending()))
+                pDisplay->request_frame(this);
+        }
+
+        void Window::query_resize()
+        {
+            WidgetContainer::query_resize();
+            if ((bMapped) && (resize_pending()))
+                pDisplay->request_frame(this);
+        }
+
+        void Window::damage_widget(Widget *w)
+        {
+            // Redraw of the whole window is pending, no need to track damage
+            if ((w == this) || (nFlags & REDRAW_SURFACE))
+            {
+                vDamage.clear();
+                return;
+            }
+
+            ws::rectangle_t r;
+            w->get_padded_rectangle(&r);
+            damage_area(&r);
+        }
+
+        void Window::damage_area(const ws::rectangle_t *area)
+        {
+            // Clip damaged area to the window
+            ws::rectangle_t xr, r;
+            xr.nLeft        = 0;
+            xr.nTop         = 0;
+            xr.nWidth       = sSize.nWidth;
+            xr.nHeight      = sSize.nHeight;
+            if (!Size::intersection(&r, area, &xr))
+                return;
+
+            // Merge the area with all overlapping rectangles
+            for (size_t i=0; i<vDamage.size(); )
+            {
+                ws::rectangle_t *dr = vDamage.uget(i);
+                if (Size::contains(dr, &r))
+                    return;
+                if (Size::overlap(dr, &r))
+                {
+                    // Extend the area and check all rectangles again
+                    Size::enclose(&r, dr);
+                    vDamage.qremove(i);
+                    i = 0;
+                }
+                else
+                    ++i;
+            }
+
+            // Too many rectangles? Merge all of them into one
+            if (vDamage.size() >= DAMAGE_MAX_RECTS)
+            {
+                for (size_t i=0, n=vDamage.size(); i<n; ++i)
+                    Size::enclose(&r, vDamage.uget(i));
+                vDamage.clear();
+            }
+
+            vDamage.add(&r);
+        }
+
         status_t Window::get_screen_rectangle(ws::rectangle_t *r)
         {
             if (pWindow == NULL)
@@ -661,7 +751,6 @@ namespace lsp
                     if (!bMapped)
                     {
                         bMapped     = true;
-                        sRedraw.launch(-1, 40);
                         query_draw(REDRAW_SURFACE);
                     }
                     break;
@@ -671,13 +760,8 @@ namespace lsp
                     if (bMapped)
                     {
                         bMapped     = false;
-                        if (pSurface != NULL)
-                        {
-                            pSurface->destroy();
-                            delete pSurface;
-                            pSurface = NULL;
-                        }
-                        sRedraw.cancel();
+                        drop_surface();
+                        pDisplay->cancel_frame(this);
                     }
                     break;
 
@@ -23,6 +23,7 @@
 #include <lsp-plug.in/common/debug.h>
 #include <lsp-plug.in/runtime/system.h>
 #include <lsp-plug.in/io/Dir.h>
+#include <lsp-plug.in/io/File.h>
 #include <private/tk/style/BuiltinStyle.h>
 
 namespace lsp
@@ -196,6 +197,207 @@ namespace lsp
 
         const w_class_t FileDialog::metadata            = { "FileDialog", &Window::metadata };
 
+        static const size_t SCAN_BATCH_SIZE             = 256;      // Number of entries passed to the dialog at once
+        static const size_t SCAN_POLL_INTERVAL          = 40;       // Interval of fetching scan results, milliseconds
+        static const size_t DIR_CACHE_SIZE              = 16;       // Maximum number of cached directory listings
+
+        //-----------------------------------------------------------------
+        // Directory scanner
+        FileDialog::DirScanner::DirScanner()
+        {
+            nMTime          = 0;
+            nCachedMTime    = 0;
+            nResult         = STATUS_OK;
+            bCached         = false;
+            bCancelled      = false;
+            bCompleted      = false;
+            bUnchanged      = false;
+        }
+
+        FileDialog::DirScanner::~DirScanner()
+        {
+            destroy_file_entries(&vBatch);
+            vBatch.flush();
+        }
+
+        status_t FileDialog::DirScanner::init(const io::Path *path, const dir_cache_t *cache)
+        {
+            LSP_STATUS_ASSERT(sPath.set(path));
+            if (cache != NULL)
+            {
+                bCached         = true;
+                nCachedMTime    = cache->nMTime;
+            }
+            return STATUS_OK;
+        }
+
+        void FileDialog::DirScanner::stop()
+        {
+            bCancelled      = true;
+        }
+
+        bool FileDialog::DirScanner::submit(lltl::parray<f_entry_t> *batch)
+        {
+            if (batch->is_empty())
+                return true;
+
+            if (!sLock.lock())
+            {
+                destroy_file_entries(batch);
+                return false;
+            }
+
+            // Move entries to the shared list
+            bool res = true;
+            for (size_t i=0, n=batch->size(); i<n; ++i)
+            {
+                f_entry_t *ent = batch->uget(i);
+                if (!vBatch.add(ent))
+                {
+                    delete ent;
+                    res     = false;
+                }
+            }
+            batch->clear();
+            sLock.unlock();
+
+            return res;
+        }
+
+        void FileDialog::DirScanner::complete(status_t result, bool unchanged)
+        {
+            if (!sLock.lock())
+                return;
+            nResult         = result;
+            bUnchanged      = unchanged;
+            bCompleted      = true;
+            sLock.unlock();
+        }
+
+        bool FileDialog::DirScanner::fetch(lltl::parray<f_entry_t> *dst)
+        {
+            if (!sLock.lock())
+                return false;
+
+            // Move entries to the destination list
+            bool done       = bCompleted;
+            size_t i = 0, n = vBatch.size();
+            for ( ; i<n; ++i)
+            {
+                if (!dst->add(vBatch.uget(i)))
+                    break;
+            }
+            if (i < n)
+            {
+                // Keep entries that have not been moved for the next call
+                while ((i--) > 0)
+                    vBatch.remove(size_t(0));
+                done            = false;
+            }
+            else
+                vBatch.clear();
+
+            sLock.unlock();
+            return done;
+        }
+
+        status_t FileDialog::DirScanner::run()
+        {
+            io::fattr_t fattr;
+            io::Path fname;
+            lltl::parray<f_entry_t> batch;
+
+            // Do not read the directory if it has not been modified since the cached scan
+            status_t res    = io::File::stat(&sPath, &fattr);
+            if (res == STATUS_OK)
+            {
+                nMTime          = fattr.mtime;
+                if ((bCached) && (nMTime == nCachedMTime))
+                {
+                    complete(STATUS_OK, true);
+                    return STATUS_OK;
+                }
+            }
+
+            // Open directory for reading
+            io::Dir dir;
+            res             = dir.open(&sPath);
+            if (res != STATUS_OK)
+            {
+                complete(res, false);
+                return res;
+            }
+
+            // Read directory
+            while ((!bCancelled) && (dir.reads(&fname, &fattr, false) == STATUS_OK))
+            {
+                // Reject dot and dotdot from search
+                if ((fname.is_dot()) || (fname.is_dotdot()))
+                    continue;
+
+                // Analyze file flags
+                size_t nflags = 0;
+                if (fname.as_string()->first() == '.')
+                    nflags      |= F_ISHIDDEN;
+
+                if (fattr.type == io::fattr_t::FT_DIRECTORY) // Directory?
+                    nflags      |= F_ISDIR;
+                else if (fattr.type == io::fattr_t::FT_SYMLINK) // Symbolic link?
+                    nflags      |= F_ISLINK;
+                else if (fattr.type == io::fattr_t::FT_REGULAR)
+                    nflags      |= F_ISREG;
+                else
+                    nflags      |= F_ISOTHER;
+
+                if (nflags & F_ISLINK)
+                {
+                    // Stat a file associated with symbolic link
+                    res = dir.sym_stat(&fname, &fattr);
+
+                    if (res != STATUS_OK)
+                        nflags      |= F_ISINVALID;
+                    else if (fattr.type == io::fattr_t::FT_DIRECTORY) // Directory?
+                        nflags      |= F_ISDIR;
+                    else if (fattr.type == io::fattr_t::FT_SYMLINK) // Symbolic link?
+                        nflags      |= F_ISLINK;
+                    else if (fattr.type == io::fattr_t::FT_REGULAR)
+                        nflags      |= F_ISREG;
+                    else
+                        nflags      |= F_ISOTHER;
+                }
+
+                // Add entry to the batch and pass the batch to the dialog if it is full
+                res = add_file_entry(&batch, fname.as_native(), nflags);
+                if ((res == STATUS_OK) && (batch.size() >= SCAN_BATCH_SIZE))
+                    res = (submit(&batch)) ? STATUS_OK : STATUS_NO_MEM;
+
+                if (res != STATUS_OK)
+                {
+                    dir.close();
+                    destroy_file_entries(&batch);
+                    complete(res, false);
+                    return res;
+                }
+            }
+
+            // Close directory
+            res = dir.close();
+            if (res != STATUS_OK)
+                res = STATUS_IO_ERROR;
+            else if (bCancelled)
+                res = STATUS_CANCELLED;
+            else if (!submit(&batch))
+                res = STATUS_NO_MEM;
+
+            destroy_file_entries(&batch);
+            complete(res, false);
+
+            return res;
+        }
+
+        //-----------------------------------------------------------------
+        // File dialog
+
         FileDialog::FileDialog(Display *dpy):
             Window(dpy),
 
@@ -250,12 +452,19 @@ namespace lsp
             pActionAlign    = NULL;
             pNavBox         = NULL;
 
+            pScanner        = NULL;
+            nScanFlags      = 0;
+            nFilterTag      = -1;
+
             pClass          = &metadata;
         }
 
         FileDialog::~FileDialog()
         {
             nFlags     |= FINALIZED;
+
+            cancel_scan();
+            reap_scanners(true);
         }
 
         void FileDialog::destroy()
@@ -263,8 +472,12 @@ namespace lsp
             nFlags     |= FINALIZED;
             Window::destroy();
 
+            cancel_scan();
+            reap_scanners(true);
+            drop_dir_cache();
             drop_bookmarks();
-            destroy_file_entries(&vFiles);
+            destroy_files();
+            destroy_file_entries(&vScanned);
 
             // Clear dynamically allocated widgets
             size_t n = vWidgets.size();
@@ -343,12 +556,31 @@ namespace lsp
             for (size_t i=0, n = list->size(); i<n; ++i)
             {
                 f_entry_t *fd = list->uget(i);
-                if (fd != NULL)
-                    delete fd;
+                if (fd == NULL)
+                    continue;
+                if (fd->pItem != NULL)
+                {
+                    fd->pItem->destroy();
+                    delete fd->pItem;
+                }
+                delete fd;
             }
             list->clear();
         }
 
+        status_t FileDialog::copy_file_entries(lltl::parray<f_entry_t> *dst, const lltl::parray<f_entry_t> *src)
+        {
+            for (size_t i=0, n=src->size(); i<n; ++i)
+            {
+                const f_entry_t *ent = src->uget(i);
+                if ((ent == NULL) || (ent->nFlags & F_DOTDOT))
+                    continue;
+                LSP_STATUS_ASSERT(add_file_entry(dst, &ent->sName, ent->nFlags));
+            }
+
+            return STATUS_OK;
+        }
+
         status_t FileDialog::init()
         {
             Label *l;
@@ -358,6 +590,9 @@ namespace lsp
 
             lsp_trace("Scaling factor: %f", sScaling.get());
 
+            sScanTimer.bind(pDisplay);
+            sScanTimer.set_handler(scan_timer_handler, self());
+
             // Init styles
             pNavButton      = pDisplay->schema()->get("FileDialog::NavButton");
             if (pNavButton == NULL)
@@ -1239,7 +1474,8 @@ namespace lsp
             if (pWConfirm != NULL)
                 pWConfirm->hide();
             hide();
-            destroy_file_entries(&vFiles);
+            cancel_scan();
+            destroy_files();
             drop_bookmarks();
 
             // Execute slots
@@ -1253,7 +1489,8 @@ namespace lsp
                 pWConfirm->hide();
             drop_bookmarks();
             hide();
-            destroy_file_entries(&vFiles);
+            cancel_scan();
+            destroy_files();
 
             // Execute slots
             return sSlots.execute(SLOT_CANCEL, this, data);
@@ -1720,10 +1957,13 @@ namespace lsp
 
         status_t FileDialog::refresh_current_path()
         {
-            lltl::parray<f_entry_t> scanned;
-            LSPString str, path;
+            LSPString path;
             status_t xres;
 
+            // Cancel the previous scan
+            cancel_scan();
+            destroy_files();
+
             // Obtain the path to working directory
             io::Path xpath;
             xres = sPath.format(&path);
@@ -1739,106 +1979,277 @@ namespace lsp
                 }
             }
             if ((xres == STATUS_OK) && (!xpath.is_root())) // Need to add dotdot entry?
-                xres = add_file_entry(&scanned, "..", F_DOTDOT);
+                xres = add_file_entry(&vFiles, "..", F_DOTDOT);
 
             if (xres != STATUS_OK) // Check result
             {
-                destroy_file_entries(&scanned);
+                destroy_file_entries(&vFiles);
                 return xres;
             }
 
-            // Open directory for reading
-            io::Dir dir;
-            xres = dir.open(&xpath);
-            if (xres == STATUS_OK)
+            // Show the cached listing while the directory is being scanned
+            dir_cache_t *cache = find_dir_cache(xpath.as_string());
+            if (cache != NULL)
             {
-                sWWarning.hide();
+                LSP_STATUS_ASSERT(copy_file_entries(&vFiles, &cache->vFiles));
+                nScanFlags     |= SCAN_CACHED;
+            }
 
-                // Read directory
-                io::fattr_t fattr;
-                io::Path fname;
+            // Launch the directory scanner
+            DirScanner *scanner = new DirScanner();
+            if (scanner == NULL)
+                return STATUS_NO_MEM;
+            if ((xres = scanner->init(&xpath, cache)) != STATUS_OK)
+            {
+                delete scanner;
+                return xres;
+            }
 
-                while (dir.reads(&fname, &fattr, false) == STATUS_OK)
-                {
-                    // Reject dot and dotdot from search
-                    if ((fname.is_dot()) || (fname.is_dotdot()))
-                        continue;
+            pScanner        = scanner;
+            if (scanner->start() == STATUS_OK)
+                sScanTimer.launch(-1, SCAN_POLL_INTERVAL, SCAN_POLL_INTERVAL);
+            else
+            {
+                // Could not start thread, perform synchronous scan
+                nScanFlags     |= SCAN_SYNC;
+                scanner->run();
+                sync_scan();
+                return select_current_bookmark();
+            }
 
-                    // Analyze file flags
-                    size_t nflags = 0;
-                    if (fname.as_string()->first() == '.')
-                        nflags      |= F_ISHIDDEN;
+            apply_filters();
 
-                    if (fattr.type == io::fattr_t::FT_DIRECTORY) // Directory?
-                        nflags      |= F_ISDIR;
-                    else if (fattr.type == io::fattr_t::FT_SYMLINK) // Symbolic link?
-                        nflags      |= F_ISLINK;
-                    else if (fattr.type == io::fattr_t::FT_REGULAR)
-                        nflags      |= F_ISREG;
-                    else
-                        nflags      |= F_ISOTHER;
+            return select_current_bookmark();
+        }
 
-                    if (nflags & F_ISLINK)
-                    {
-                        // Stat a file associated with symbolic link
-                        xres = dir.sym_stat(&fname, &fattr);
-
-                        if (xres != STATUS_OK)
-                            nflags      |= F_ISINVALID;
-                        else if (fattr.type == io::fattr_t::FT_DIRECTORY) // Directory?
-                            nflags      |= F_ISDIR;
-                        else if (fattr.type == io::fattr_t::FT_SYMLINK) // Symbolic link?
-                            nflags      |= F_ISLINK;
-                        else if (fattr.type == io::fattr_t::FT_REGULAR)
-                            nflags      |= F_ISREG;
-                        else
-                            nflags      |= F_ISOTHER;
-                    }
+        status_t FileDialog::scan_timer_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg)
+        {
+            FileDialog *_this = widget_ptrcast<FileDialog>(arg);
+            return (_this != NULL) ? _this->sync_scan() : STATUS_OK;
+        }
+
+        status_t FileDialog::sync_scan()
+        {
+            reap_scanners(false);
+            if (pScanner == NULL)
+            {
+                sScanTimer.cancel();
+                return STATUS_OK;
+            }
 
-                    // Add entry to list of found files
-                    if ((xres = add_file_entry(&scanned, fname.as_native(), nflags)) != STATUS_OK)
+            // Fetch new entries from the scanner
+            bool cached     = nScanFlags & SCAN_CACHED;
+            lltl::parray<f_entry_t> *dst = (cached) ? &vScanned : &vFiles;
+            size_t count    = dst->size();
+
+            if (!pScanner->fetch(dst))
+            {
+                // Show the partial listing if there is no cached one
+                if ((!cached) && (dst->size() != count))
+                {
+                    if (!merge_file_entries(count))
                     {
-                        dir.close();
-                        destroy_file_entries(&scanned);
-                        return xres;
+                        drop_filters();
+                        vFiles.qsort(cmp_file_entry);
                     }
+                    return apply_filters();
+                }
+                return STATUS_OK;
+            }
+
+            // The scan is complete
+            sScanTimer.cancel();
+            DirScanner *scanner = pScanner;
+            pScanner        = NULL;
+            if (!(nScanFlags & SCAN_SYNC))
+                scanner->join();
+            nScanFlags     &= ~SCAN_SYNC;
+
+            status_t res    = scanner->result();
+            if ((res == STATUS_OK) && (scanner->unchanged()))
+            {
+                // Cached listing is actual
+                nScanFlags     &= ~SCAN_CACHED;
+                sWWarning.hide();
+                delete scanner;
+                return STATUS_OK;
+            }
+
+            if (cached)
+            {
+                // Replace the cached listing with the scanned one, keep the dotdot entry
+                lltl::parray<f_entry_t> removed;
+                drop_filters();
+                sWFiles.items()->clear();
+                removed.swap(&vFiles);
+                for (size_t i=0, n=removed.size(); i<n; ++i)
+                {
+                    f_entry_t *ent = removed.uget(i);
+                    if ((ent != NULL) && (ent->nFlags & F_DOTDOT) && (vScanned.add(ent)))
+                        removed.set(i, NULL);
                 }
+                destroy_file_entries(&removed);
+                vFiles.swap(&vScanned);
+                nScanFlags     &= ~SCAN_CACHED;
+                vFiles.qsort(cmp_file_entry);
+            }
+            else if (!merge_file_entries(count))
+            {
+                // Merge the last batch into the partial listing
+                drop_filters();
+                vFiles.qsort(cmp_file_entry);
+            }
 
-                // Close directory
-                if (dir.close() != STATUS_OK)
+            if (res == STATUS_OK)
+            {
+                sWWarning.hide();
+                update_dir_cache(scanner->path()->as_string(), scanner->mtime());
+            }
+            else if (res != STATUS_CANCELLED)
+                show_access_error(res);
+
+            delete scanner;
+
+            return apply_filters();
+        }
+
+        void FileDialog::cancel_scan()
+        {
+            sScanTimer.cancel();
+            destroy_file_entries(&vScanned);
+            nScanFlags     &= ~(SCAN_CACHED | SCAN_SYNC);
+
+            if (pScanner != NULL)
+            {
+                // Do not wait for the thread, it may be blocked by slow I/O
+                pScanner->stop();
+                if (!vRetired.add(pScanner))
                 {
-                    destroy_file_entries(&scanned);
-                    return STATUS_IO_ERROR;
+                    pScanner->join();
+                    delete pScanner;
                 }
+                pScanner        = NULL;
             }
-            else // Analyze errcode
+
+            reap_scanners(false);
+        }
+
+        void FileDialog::reap_scanners(bool wait)
+        {
+            for (size_t i=0; i<vRetired.size(); )
             {
-                const char *text = "unknown I/O error";
-                switch (xres)
+                DirScanner *scanner = vRetired.uget(i);
+                if ((!wait) && (!scanner->completed()))
                 {
-                    case STATUS_PERMISSION_DENIED:    text = "permission denied"; break;
-                    case STATUS_NOT_FOUND:    text = "directory does not exist"; break;
-                    case STATUS_NO_MEM:    text = "not enough memory"; break;
-                    default: break;
+                    ++i;
+                    continue;
                 }
 
-                str.set_native("Access error: ");
-                path.set_native(text);
-                str.append(&path);
-                sWWarning.text()->set_raw(&str);
-                sWWarning.show();
+                scanner->stop();
+                scanner->join();
+                delete scanner;
+                vRetired.remove(i);
             }
 
-            // Now we have the complete list of files, need to reorder them
-            scanned.qsort(cmp_file_entry);
+            if (wait)
+                vRetired.flush();
+        }
 
-            // Alright, now we can swap contents and delete previous contents
-            vFiles.swap(&scanned);
-            destroy_file_entries(&scanned);
+        void FileDialog::show_access_error(status_t code)
+        {
+            LSPString str, msg;
+            const char *text = "unknown I/O error";
+            switch (code)
+            {
+                case STATUS_PERMISSION_DENIED:    text = "permission denied"; break;
+                case STATUS_NOT_FOUND:    text = "directory does not exist"; break;
+                case STATUS_NO_MEM:    text = "not enough memory"; break;
+                default: break;
+            }
 
-            apply_filters();
+            str.set_native("Access error: ");
+            msg.set_native(text);
+            str.append(&msg);
+            sWWarning.text()->set_raw(&str);
+            sWWarning.show();
+        }
 
-            return select_current_bookmark();
+        FileDialog::dir_cache_t *FileDialog::find_dir_cache(const LSPString *path)
+        {
+            for (size_t i=0, n=vDirCache.size(); i<n; ++i)
+            {
+                dir_cache_t *c = vDirCache.uget(i);
+                if (!c->sPath.equals(path))
+                    continue;
+
+                // Move the entry to the head of the list
+                if (i > 0)
+                {
+                    vDirCache.remove(i);
+                    if (!vDirCache.insert(0, c))
+                    {
+                        destroy_file_entries(&c->vFiles);
+                        delete c;
+                        return NULL;
+                    }
+                }
+                return c;
+            }
+
+            return NULL;
+        }
+
+        status_t FileDialog::update_dir_cache(const LSPString *path, wsize_t mtime)
+        {
+            // Directory without modification time can not be validated
+            if (mtime == 0)
+                return STATUS_OK;
+
+            dir_cache_t *c = find_dir_cache(path);
+            if (c == NULL)
+            {
+                c = new dir_cache_t;
+                if (c == NULL)
+                    return STATUS_NO_MEM;
+                if ((!c->sPath.set(path)) || (!vDirCache.insert(0, c)))
+                {
+                    delete c;
+                    return STATUS_NO_MEM;
+                }
+
+                // Evict the least recently used listing
+                while (vDirCache.size() > DIR_CACHE_SIZE)
+                {
+                    dir_cache_t *x = vDirCache.last();
+                    vDirCache.pop();
+                    destroy_file_entries(&x->vFiles);
+                    delete x;
+                }
+            }
+            else
+                destroy_file_entries(&c->vFiles);
+
+            c->nMTime       = mtime;
+            status_t res    = copy_file_entries(&c->vFiles, &vFiles);
+            if (res != STATUS_OK)
+            {
+                vDirCache.premove(c);
+                destroy_file_entries(&c->vFiles);
+                delete c;
+            }
+
+            return res;
+        }
+
+        void FileDialog::drop_dir_cache()
+        {
+            for (size_t i=0, n=vDirCache.size(); i<n; ++i)
+            {
+                dir_cache_t *c = vDirCache.uget(i);
+                destroy_file_entries(&c->vFiles);
+                delete c;
+            }
+            vDirCache.flush();
         }
 
         int FileDialog::cmp_file_entry(const f_entry_t *a, const f_entry_t *b)
@@ -1871,6 +2282,7 @@ namespace lsp
                 return STATUS_NO_MEM;
             }
             ent->nFlags     = flags;
+            ent->pItem      = NULL;
 
             if (!dst->add(ent))
             {
@@ -1929,109 +2341,328 @@ namespace lsp
             return STATUS_OK;
         }
 
-        status_t FileDialog::apply_filters()
+        void FileDialog::destroy_files()
         {
-            LSPString tmp, xfname, *psrc = NULL;
-            io::PathPattern *psmask = NULL, smask;
-            FileMask *fmask = NULL;
+            // Items of entries should be removed from the list before destruction
+            drop_filters();
+            sWFiles.selected()->clear();
+            sWFiles.items()->clear();
+            destroy_file_entries(&vFiles);
+        }
 
-            // Initialize masks
-            if (sMode.get() == FDM_OPEN_FILE) // Additional filtering is available only when opening file
+        void FileDialog::drop_filters()
+        {
+            for (size_t i=0, n=vFilters.size(); i<n; ++i)
+            {
+                filter_t *f = vFilters.uget(i);
+                if (f != NULL)
+                    delete f;
+            }
+            vFilters.flush();
+            nFilterTag      = -1;
+        }
+
+        bool FileDialog::merge_file_entries(size_t first)
+        {
+            size_t count    = vFiles.size();
+            if (first >= count)
+                return true;
+
+            // Sort only the new entries
+            lltl::parray<f_entry_t> batch, merged;
+            for (size_t i=first; i<count; ++i)
+                if (!batch.add(vFiles.uget(i)))
+                    return false;
+            batch.qsort(cmp_file_entry);
+
+            // Merge them with the sorted listing, remember the origin of each entry:
+            // non-negative values are previous indexes, negative ones are the inverted batch indexes
+            lltl::darray<ssize_t> origin;
+            for (size_t i=0, j=0, n=batch.size(); (i < first) || (j < n); )
             {
-                LSP_STATUS_ASSERT(sWSearch.text()->format(&tmp));
-                if (tmp.length() > 0)
+                ssize_t *src    = origin.add();
+                if (src == NULL)
+                    return false;
+
+                f_entry_t *ent;
+                if ((j >= n) || ((i < first) && (cmp_file_entry(vFiles.uget(i), batch.uget(j)) <= 0)))
                 {
-                    if (!tmp.prepend('*'))
-                        return STATUS_NO_MEM;
-                    if (!tmp.append('*'))
-                        return STATUS_NO_MEM;
-                    LSP_STATUS_ASSERT(smask.set(&tmp));
-                    psmask = &smask;
+                    *src            = i;
+                    ent             = vFiles.uget(i++);
+                }
+                else
+                {
+                    *src            = ~ssize_t(j);
+                    ent             = batch.uget(j++);
                 }
+
+                if (!merged.add(ent))
+                    return false;
             }
-            else
+
+            // Compute the number of filters in the stack passed by each new entry
+            lltl::darray<size_t> depth;
+            const FileMask *fmask = (nFilterTag >= 0) ? sFilter.get(nFilterTag) : NULL;
+            for (size_t i=0, n=(vFilters.is_empty()) ? 0 : batch.size(); i<n; ++i)
             {
-                sWFiles.selected()->clear();
-                LSP_STATUS_ASSERT(sWSearch.text()->format(&xfname));
+                f_entry_t *ent  = batch.uget(i);
+                size_t *d       = depth.add();
+                if (d == NULL)
+                    return false;
+
+                if (ent->nFlags & (F_ISDIR | F_DOTDOT))
+                    *d              = vFilters.size();
+                else if ((fmask != NULL) && (!fmask->test(&ent->sName)))
+                    *d              = 0;
+                else
+                {
+                    for (*d = 1; *d < vFilters.size(); ++(*d))
+                        if (!vFilters.uget(*d)->sPattern.test(&ent->sName))
+                            break;
+                }
             }
 
-            if (sWFilter.items()->size() > 0)
+            // Re-map indexes of the filters, previous entries are not tested again
+            for (size_t k=0, nf=vFilters.size(); k<nf; ++k)
             {
-                ListBoxItem *sel = sWFilter.selected()->get();
-                ssize_t tag      = (sel != NULL) ? sel->tag()->get() : -1;
-                fmask            = (tag >= 0) ? sFilter.get(tag) : NULL;
+                filter_t *f     = vFilters.uget(k);
+                lltl::darray<size_t> indexes;
+
+                for (size_t p=0, i=0, n=origin.size(), m=f->vIndexes.size(); p<n; ++p)
+                {
+                    ssize_t src     = *(origin.uget(p));
+                    bool match;
+                    if (src >= 0)
+                    {
+                        while ((i < m) && (*(f->vIndexes.uget(i)) < size_t(src)))
+                            ++i;
+                        match           = (i < m) && (*(f->vIndexes.uget(i)) == size_t(src));
+                    }
+                    else
+                        match           = *(depth.uget(~src)) > k;
+
+                    if (!match)
+                        continue;
+                    size_t *idx     = indexes.add();
+                    if (idx == NULL)
+                        return false;
+                    *idx            = p;
+                }
+
+                f->vIndexes.swap(&indexes);
             }
 
-            // Now we need to fill data
-            WidgetList<ListBoxItem> *lst = sWFiles.items();
-            lst->clear();
-            float xs = sWFiles.hscroll()->get(), ys = sWFiles.vscroll()->get(); // Remember scroll values
+            vFiles.swap(&merged);
+            return true;
+        }
+
+        static bool is_plain_text(const LSPString *text)
+        {
+            // Check that the text does not contain special characters of the path pattern
+            for (size_t i=0, n=text->length(); i<n; ++i)
+            {
+                switch (text->char_at(i))
+                {
+                    case '*': case '?': case '[': case ']':
+                    case '(': case ')': case '|': case '&':
+                    case '!': case '`': case '\\': case '/':
+                        return false;
+                    default:
+                        break;
+                }
+            }
+            return true;
+        }
 
-            // Process files
-            for (size_t i=0, n=vFiles.size(); i<n; ++i)
+        FileDialog::filter_t *FileDialog::select_filter(const LSPString *text, const FileMask *fmask)
+        {
+            filter_t *f;
+
+            // Create the base filter which applies the file mask only
+            if (vFilters.is_empty())
             {
-                f_entry_t *ent = vFiles.uget(i);
-                psrc = &ent->sName;
+                if ((f = new filter_t) == NULL)
+                    return NULL;
+                if (!vFilters.add(f))
+                {
+                    delete f;
+                    return NULL;
+                }
 
-                // Pass entry name through filter
-                if (!(ent->nFlags & (F_ISDIR | F_DOTDOT)))
+                for (size_t i=0, n=vFiles.size(); i<n; ++i)
                 {
-                    // Process with masks
-                    if ((fmask != NULL) && (!fmask->test(psrc)))
-                        continue;
-                    if ((psmask != NULL) && (!psmask->test(psrc)))
+                    f_entry_t *ent = vFiles.uget(i);
+                    if ((!(ent->nFlags & (F_ISDIR | F_DOTDOT))) && (fmask != NULL) && (!fmask->test(&ent->sName)))
                         continue;
+
+                    size_t *idx = f->vIndexes.add();
+                    if (idx == NULL)
+                        return NULL;
+                    *idx        = i;
                 }
+            }
 
-                // Add some special characters
-                if (ent->nFlags & (F_ISOTHER | F_ISDIR | F_ISLINK | F_ISINVALID))
-                {
-                    if (!tmp.set(psrc))
-                    {
-                        lst->clear();
-                        return STATUS_NO_MEM;
-                    }
-                    psrc = &tmp;
+            // Drop filters which can not be narrowed to the new search text
+            bool plain = is_plain_text(text);
+            while (vFilters.size() > 1)
+            {
+                f   = vFilters.last();
+                if (f->sText.equals(text))
+                    return f;
+                if ((plain) && (is_plain_text(&f->sText)) && (text->index_of(&f->sText) >= 0))
+                    break;
 
-                    // Modify the name of the item
-                    bool ok = true;
-                    if (ent->nFlags & F_ISOTHER)
-                        ok = ok && psrc->prepend('*');
-                    else if (ent->nFlags & (F_ISLINK | F_ISINVALID))
-                        ok = ok && psrc->prepend((ent->nFlags & F_ISINVALID) ? '!' : '~');
+                vFilters.pop();
+                delete f;
+            }
 
-                    if (ent->nFlags & F_ISDIR)
-                    {
-                        ok = ok && psrc->prepend('[');
-                        ok = ok && psrc->append(']');
-                    }
+            filter_t *prev = vFilters.last();
+            if (text->length() <= 0)
+                return prev;
 
-                    if (!ok)
-                    {
-                        lst->clear();
-                        return STATUS_NO_MEM;
-                    }
+            // Create new filter and apply it to the result of the previous one
+            LSPString mask;
+            if ((f = new filter_t) == NULL)
+                return NULL;
+            if ((!f->sText.set(text)) ||
+                (!mask.set(text)) ||
+                (!mask.prepend('*')) ||
+                (!mask.append('*')) ||
+                (f->sPattern.set(&mask) != STATUS_OK) ||
+                (!vFilters.add(f)))
+            {
+                delete f;
+                return NULL;
+            }
+
+            for (size_t i=0, n=prev->vIndexes.size(); i<n; ++i)
+            {
+                size_t index    = *(prev->vIndexes.uget(i));
+                f_entry_t *ent  = vFiles.uget(index);
+                if ((!(ent->nFlags & (F_ISDIR | F_DOTDOT))) && (!f->sPattern.test(&ent->sName)))
+                    continue;
+
+                size_t *idx = f->vIndexes.add();
+                if (idx == NULL)
+                    return NULL;
+                *idx        = index;
+            }
+
+            return f;
+        }
+
+        ListBoxItem *FileDialog::create_file_item(f_entry_t *ent)
+        {
+            LSPString tmp;
+            const LSPString *psrc = &ent->sName;
+
+            // Add some special characters
+            if (ent->nFlags & (F_ISOTHER | F_ISDIR | F_ISLINK | F_ISINVALID))
+            {
+                if (!tmp.set(psrc))
+                    return NULL;
+                psrc = &tmp;
+
+                // Modify the name of the item
+                bool ok = true;
+                if (ent->nFlags & F_ISOTHER)
+                    ok = ok && tmp.prepend('*');
+                else if (ent->nFlags & (F_ISLINK | F_ISINVALID))
+                    ok = ok && tmp.prepend((ent->nFlags & F_ISINVALID) ? '!' : '~');
+
+                if (ent->nFlags & F_ISDIR)
+                {
+                    ok = ok && tmp.prepend('[');
+                    ok = ok && tmp.append(']');
                 }
 
-                // Add item
-                ListBoxItem *item = new ListBoxItem(pDisplay);
+                if (!ok)
+                    return NULL;
+            }
+
+            // Create item
+            ListBoxItem *item = new ListBoxItem(pDisplay);
+            if (item == NULL)
+                return NULL;
+            if ((item->init() != STATUS_OK) || (item->text()->set_raw(psrc) != STATUS_OK))
+            {
+                item->destroy();
+                delete item;
+                return NULL;
+            }
+
+            ent->pItem      = item;
+            return item;
+        }
+
+        status_t FileDialog::apply_filters()
+        {
+            LSPString text, xfname;
+            FileMask *fmask = NULL;
+            ssize_t tag     = -1;
+
+            // Initialize masks
+            if (sMode.get() == FDM_OPEN_FILE) // Additional filtering is available only when opening file
+                LSP_STATUS_ASSERT(sWSearch.text()->format(&text));
+            else
+            {
+                sWFiles.selected()->clear();
+                LSP_STATUS_ASSERT(sWSearch.text()->format(&xfname));
+            }
+
+            if (sWFilter.items()->size() > 0)
+            {
+                ListBoxItem *sel = sWFilter.selected()->get();
+                tag              = (sel != NULL) ? sel->tag()->get() : -1;
+                fmask            = (tag >= 0) ? sFilter.get(tag) : NULL;
+            }
+
+            // Select the filter, the filters are valid only for the same file mask
+            if (tag != nFilterTag)
+                drop_filters();
+            nFilterTag      = tag;
+
+            filter_t *f     = select_filter(&text, fmask);
+            if (f == NULL)
+            {
+                drop_filters();
+                return STATUS_NO_MEM;
+            }
+
+            // Now we need to fill data, reuse items of entries that have been shown before
+            lltl::parray<Widget> items;
+            float xs = sWFiles.hscroll()->get(), ys = sWFiles.vscroll()->get(); // Remember scroll values
+
+            for (size_t i=0, n=f->vIndexes.size(); i<n; ++i)
+            {
+                size_t index        = *(f->vIndexes.uget(i));
+                f_entry_t *ent      = vFiles.uget(index);
+                ListBoxItem *item   = (ent->pItem != NULL) ? ent->pItem : create_file_item(ent);
                 if (item == NULL)
                     return STATUS_NO_MEM;
-                LSP_STATUS_ASSERT(item->init());
-                item->text()->set_raw(psrc);
-                item->tag()->set(i);
-                LSP_STATUS_ASSERT(lst->madd(item));
 
-                // Check if is equal
-                if ((!(ent->nFlags & (F_ISDIR | F_DOTDOT))) && (xfname.length() > 0))
+                item->tag()->set(index);
+                if (!items.add(item))
+                    return STATUS_NO_MEM;
+            }
+
+            LSP_STATUS_ASSERT(sWFiles.items()->assign(&items));
+
+            // Select the item with the same name as the entered one
+            if (xfname.length() > 0)
+            {
+                for (size_t i=0, n=f->vIndexes.size(); i<n; ++i)
                 {
-//                    lsp_trace("  %s <-> %s", ent->sName.get_native(), xfname.get_native());
+                    f_entry_t *ent      = vFiles.uget(*(f->vIndexes.uget(i)));
+                    if (ent->nFlags & (F_ISDIR | F_DOTDOT))
+                        continue;
+
                     #ifdef PLATFORM_WINDOWS
                     if (ent->sName.equals_nocase(&xfname))
-                        sWFiles.selected()->add(item);
+                        sWFiles.selected()->add(ent->pItem);
                     #else
                     if (ent->sName.equals(&xfname))
-                        sWFiles.selected()->add(item);
+                        sWFiles.selected()->add(ent->pItem);
                     #endif /* PLATFORM_WINDOWS */
                 }
             }
@@ -70,6 +70,9 @@ namespace lsp
             sIPadding(&sProperties)
         {
             pGlass              = NULL;
+            pStatic             = NULL;
+            nStatic             = 0;
+            bStatic             = false;
 
             sCanvas.nLeft       = 0;
             sCanvas.nTop        = 0;
@@ -108,8 +111,9 @@ namespace lsp
                 unlink_widget(item);
             }
 
-            // Destroy glass
+            // Destroy glass and cached layers
             drop_glass();
+            drop_static();
 
             vItems.flush();
             vAxis.flush();
@@ -127,6 +131,17 @@ namespace lsp
             }
         }
 
+        void Graph::drop_static()
+        {
+            if (pStatic != NULL)
+            {
+                pStatic->destroy();
+                delete pStatic;
+                pStatic = NULL;
+            }
+            bStatic     = false;
+        }
+
         status_t Graph::init()
         {
             status_t result = WidgetContainer::init();
@@ -166,7 +181,9 @@ namespace lsp
         {
             WidgetContainer::property_changed(prop);
             if (vItems.is(prop))
-                query_draw();
+                query_layer_draw(GL_STATIC);
+            if (sBrightness.is(prop))
+                query_layer_draw(GL_STATIC);
 
             if (sBorder.is(prop))
                 query_resize();
@@ -175,7 +192,7 @@ namespace lsp
             if (sGlass.is(prop))
                 query_draw();
             if (sColor.is(prop))
-                query_draw();
+                query_layer_draw(GL_STATIC);
             if (sBorderColor.is(prop))
                 query_draw();
             if (sGlassColor.is(prop))
@@ -237,12 +254,23 @@ namespace lsp
             sICanvas.nHeight= sCanvas.nHeight;
 
             sIPadding.enter(&sICanvas, scaling);
+
+            // Items may change their positions
+            bStatic         = false;
         }
 
         void Graph::hide_widget()
         {
             WidgetContainer::hide_widget();
             drop_glass();
+            drop_static();
+        }
+
+        void Graph::query_layer_draw(graph_layer_t layer)
+        {
+            if (layer == GL_STATIC)
+                bStatic     = false;
+            query_draw(REDRAW_SURFACE);
         }
 
         void Graph::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
@@ -305,15 +333,64 @@ namespace lsp
         {
             // Clear canvas
             lsp::Color c(sColor);
-            // c.set_rgb24(0x888888);
             c.scale_lightness(sBrightness.get());
             s->clear(&c);
 
             // Sync internal lists of axes and origins
             sync_lists();
 
-            // Draw all objects
+            // Items are rendered in the order of the list, only the leading run
+            // of static items is cached to keep the order of drawing
+            size_t count    = vItems.size();
+            size_t first    = static_items();
+            if (first != nStatic)
+            {
+                nStatic         = first;
+                bStatic         = false;
+            }
+
+            if (first > 0)
+            {
+                // Check that the static layer matches the size of the surface
+                if ((pStatic != NULL) &&
+                    ((pStatic->width() != s->width()) || (pStatic->height() != s->height())))
+                    drop_static();
+                if (pStatic == NULL)
+                    pStatic     = s->create(s->width(), s->height());
+
+                if (pStatic != NULL)
+                {
+                    // Render the static layer only if it has been changed
+                    if (!bStatic)
+                    {
+                        pStatic->clear(&c);
+                        render_items(pStatic, 0, first);
+                        bStatic     = true;
+                    }
+                    s->draw(pStatic, 0, 0);
+                }
+                else
+                    render_items(s, 0, first);
+            }
+
+            // Render the rest of items on top of the static layer
+            render_items(s, first, count);
+        }
+
+        size_t Graph::static_items()
+        {
             for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                GraphItem *gi = vItems.get(i);
+                if ((gi != NULL) && (gi->layer() != GL_STATIC))
+                    return i;
+            }
+            return vItems.size();
+        }
+
+        void Graph::render_items(ws::ISurface *s, size_t first, size_t last)
+        {
+            for (size_t i=first; i<last; ++i)
             {
                 GraphItem *gi = vItems.get(i);
                 if ((gi == NULL) || (!gi->visibility()->get()))
@@ -386,7 +463,7 @@ namespace lsp
                 return;
 
             item->set_parent(_this);
-            _this->query_draw();
+            _this->query_layer_draw(GL_STATIC);
         }
 
         void Graph::on_remove_item(void *obj, Property *prop, void *w)
@@ -401,7 +478,7 @@ namespace lsp
 
             // Remove widget from supplementary structures
             _this->unlink_widget(item);
-            _this->query_draw();
+            _this->query_layer_draw(GL_STATIC);
         }
 
         bool Graph::origin(size_t index, float *x, float *y)
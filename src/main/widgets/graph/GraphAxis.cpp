@@ -70,6 +70,22 @@ namespace lsp
             sOrigin(&sProperties),
             sColor(&sProperties)
         {
+            sTransform.sCanvas.nLeft    = 0;
+            sTransform.sCanvas.nTop     = 0;
+            sTransform.sCanvas.nWidth   = 0;
+            sTransform.sCanvas.nHeight  = 0;
+            sTransform.fCX              = 0.0f;
+            sTransform.fCY              = 0.0f;
+            sTransform.fDX              = 0.0f;
+            sTransform.fDY              = 0.0f;
+            sTransform.fLength          = 0.0f;
+            sTransform.fMin             = 0.0f;
+            sTransform.fMax             = 0.0f;
+            sTransform.fNorm            = 0.0f;
+            sTransform.bLog             = false;
+            sTransform.bValid           = false;
+            nSerial                     = 0;
+
             pClass              = &metadata;
         }
 
@@ -119,21 +135,39 @@ namespace lsp
             GraphItem::property_changed(prop);
 
             if (sDirection.is(prop))
+            {
+                sTransform.bValid   = false;
                 query_draw();
+            }
             if (sMin.is(prop))
+            {
+                sTransform.bValid   = false;
                 query_draw();
+            }
             if (sMax.is(prop))
+            {
+                sTransform.bValid   = false;
                 query_draw();
+            }
             if (sLogScale.is(prop))
+            {
+                sTransform.bValid   = false;
                 query_draw();
+            }
             if (sBasis.is(prop))
                 query_draw();
             if (sWidth.is(prop))
                 query_draw();
             if (sLength.is(prop))
+            {
+                sTransform.bValid   = false;
                 query_draw();
+            }
             if (sOrigin.is(prop))
+            {
+                sTransform.bValid   = false;
                 query_draw();
+            }
             if (sColor.is(prop))
                 query_draw();
         }
@@ -168,24 +202,44 @@ namespace lsp
             s->set_antialiasing(aa);
         }
 
-        bool GraphAxis::apply(float *x, float *y, const float *dv, size_t count)
+        const GraphAxis::transform_t *GraphAxis::sync_transform(Graph *cv)
         {
-            // Get graph
-            Graph *cv = graph();
-            if (cv == NULL)
-                return false;
+            transform_t *t  = &sTransform;
 
+            // Check that the cached transform matches the geometry of the graph
             float cx    = 0.0f, cy = 0.0f;
-            float fdx   = sDirection.dx(), fdy = -sDirection.dy();
             cv->origin(sOrigin.get(), &cx, &cy);
 
+            if ((t->bValid) &&
+                (t->fCX == cx) && (t->fCY == cy) &&
+                (t->sCanvas.nLeft == cv->canvas_left()) &&
+                (t->sCanvas.nTop == cv->canvas_top()) &&
+                (t->sCanvas.nWidth == cv->canvas_width()) &&
+                (t->sCanvas.nHeight == cv->canvas_height()))
+                return t;
+
+            // Compute new transform
+            t->sCanvas.nLeft    = cv->canvas_left();
+            t->sCanvas.nTop     = cv->canvas_top();
+            t->sCanvas.nWidth   = cv->canvas_width();
+            t->sCanvas.nHeight  = cv->canvas_height();
+            t->fCX              = cx;
+            t->fCY              = cy;
+            t->fDX              = sDirection.dx();
+            t->fDY              = -sDirection.dy();
+            t->fLength          = -1.0f;
+            t->fNorm            = 0.0f;
+            t->bLog             = sLogScale.get();
+            t->bValid           = true;
+            ++nSerial;
+
             float d     = sLength.get();
             if (d < 0.0f)
             {
                 float la, lb, lc;
 
-                if (!locate_line2d(fdx, fdy, cx, cy, la, lb, lc))
-                    return false;
+                if (!locate_line2d(t->fDX, t->fDY, cx, cy, la, lb, lc))
+                    return t;
 
                 float x1, y1, x2, y2;
                 if (!clip_line2d(la, lb, lc,
@@ -193,53 +247,83 @@ namespace lsp
                         x1, y1, x2, y2
                         )
                     )
-                    return false;
+                    return t;
 
                 float d1    = distance2d(cx, cy, x1, y1);
                 float d2    = distance2d(cx, cy, x2, y2);
                 d           = (d1 > d2) ? d1 : d2;
             }
-//            if (d > 1.0f)
-//                d          -= 0.5f; // Fix rounding errors
+            t->fLength  = d;
 
             // Normalize value according to minimum and maximum visible values of the axis
             float a_min = fabsf(sMin.get()), a_max = fabsf(sMax.get());
-
-            // Now we can surely apply deltas
-            if (sLogScale.get())
+            if (t->bLog)
             {
                 if (a_min <= 0.0f)
                     a_min   = 1e-10f;
                 if (a_max <= 0.0f)
                     a_max   = 1e-10f;
-                float norm = (a_min > a_max) ? logf(a_min / a_max) : logf(a_max / a_min);
-                if (norm == 0.0f)
-                    return false;
+                t->fNorm    = (a_min > a_max) ? logf(a_min / a_max) : logf(a_max / a_min);
+            }
+            else
+                t->fNorm    = (a_min > a_max) ? a_min : a_max;
 
-                norm            = d / norm;
-                a_min           = 1.0f / a_min;
+            t->fMin     = a_min;
+            t->fMax     = a_max;
 
-                dsp::axis_apply_log2(x, y, dv, a_min, norm * fdx, norm * fdy, count);
-            }
+            return t;
+        }
+
+        void GraphAxis::apply_transform(const transform_t *t, float *x, float *y, const float *dv, size_t count)
+        {
+            float norm  = t->fLength / t->fNorm;
+
+            if (t->bLog)
+                dsp::axis_apply_log2(x, y, dv, 1.0f / t->fMin, norm * t->fDX, norm * t->fDY, count);
             else
             {
-                float norm = (a_min > a_max) ? a_min : a_max;
-                if (norm == 0.0f)
-                    return false;
-                norm    = d / norm;
-
                 // Apply delta-vector
-                dsp::fmadd_k3(x, dv, norm * fdx, count);
-                dsp::fmadd_k3(y, dv, norm * fdy, count);
+                dsp::fmadd_k3(x, dv, norm * t->fDX, count);
+                dsp::fmadd_k3(y, dv, norm * t->fDY, count);
             }
 
             // Saturate values
             dsp::saturate(x, count);
             dsp::saturate(y, count);
+        }
+
+        bool GraphAxis::apply(float *x, float *y, const float *dv, size_t count)
+        {
+            return apply(&x, &y, &dv, count, 1);
+        }
+
+        bool GraphAxis::apply(float * const *x, float * const *y, const float * const *dv, size_t count, size_t series)
+        {
+            // Get graph
+            Graph *cv = graph();
+            if (cv == NULL)
+                return false;
+
+            const transform_t *t = sync_transform(cv);
+            if ((t->fLength < 0.0f) || (t->fNorm == 0.0f))
+                return false;
+
+            for (size_t i=0; i<series; ++i)
+                apply_transform(t, x[i], y[i], dv[i], count);
 
             return true;
         }
 
+        size_t GraphAxis::transform_id()
+        {
+            Graph *cv = graph();
+            if (cv == NULL)
+                return 0;
+
+            const transform_t *t = sync_transform(cv);
+            return ((t->fLength < 0.0f) || (t->fNorm == 0.0f)) ? 0 : nSerial;
+        }
+
         float GraphAxis::project(float x, float y)
         {
             // Get graph
@@ -247,63 +331,26 @@ namespace lsp
             if (cv == NULL)
                 return false;
 
-            // Get the center of coordinates
-            float cx    = 0.0f, cy = 0.0f;
-            float fdx   = sDirection.dx(), fdy = -sDirection.dy();
-            cv->origin(sOrigin.get(), &cx, &cy);
+            const transform_t *t = sync_transform(cv);
+            if (t->fLength < 0.0f)
+                return false;
 
             // Calculate the difference relative to the center and the projection vector length
-            float dx    = x - cx, dy = y - cy;
-            float pv    = dx*fdx + dy*fdy;
-
-            float d     = sLength.get();
-            if (d < 0.0f)
-            {
-                // Now prepare the image of the line
-                float la, lb, lc;
-                if (!locate_line2d(fdx, fdy, cx, cy, la, lb, lc))
-                    return false;
+            float dx    = x - t->fCX, dy = y - t->fCY;
+            float pv    = dx*t->fDX + dy*t->fDY;
 
-                float x1, y1, x2, y2;
-                if (!clip_line2d(la, lb, lc,
-                        cv->canvas_left(), cv->canvas_right(), cv->canvas_bottom(), cv->canvas_top(),
-                        x1, y1, x2, y2)
-                    )
-                    return false;
-
-                float d1    = distance2d(cx, cy, x1, y1);
-                float d2    = distance2d(cx, cy, x2, y2);
-                d           = (d1 > d2) ? d1 : d2;
-            }
+            float d     = t->fLength;
             if (d > 1.0f)
                 d          -= 0.5f; // Fix rounding errors
 
-            // Normalize value according to minimum and maximum visible values of the axis
-            float a_min = fabsf(sMin.get()), a_max = fabsf(sMax.get());
-
             // Now we can surely apply deltas
-            if (sLogScale.get())
-            {
-                if (a_min <= 0.0f)
-                    a_min   = 1e-10f;
-                if (a_max <= 0.0f)
-                    a_max   = 1e-10f;
-                float norm = (a_min > a_max) ? logf(a_min / a_max) : logf(a_max / a_min);
-                if (norm == 0.0f)
-                    return sMin.get();
-
-                return expf(pv * norm / d) * ((a_min > a_max) ? a_max : a_min);
-            }
-            else
-            {
-                float norm = (a_min > a_max) ? a_min : a_max;
-                if (norm == 0.0f)
-                    return sMin.get();
-
-                return (pv*norm/d) + ((a_min > a_max) ? a_max : a_min);
-            }
+            float a_min = t->fMin, a_max = t->fMax;
+            if (t->fNorm == 0.0f)
+                return sMin.get();
 
-            return sMin.get();
+            return (t->bLog) ?
+                expf(pv * t->fNorm / d) * ((a_min > a_max) ? a_max : a_min) :
+                (pv * t->fNorm / d) + ((a_min > a_max) ? a_max : a_min);
         }
 
         bool GraphAxis::parallel(float x, float y, float &a, float &b, float &c)
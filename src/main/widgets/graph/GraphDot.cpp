@@ -282,6 +282,11 @@ namespace lsp
                 query_draw();
         }
 
+        graph_layer_t GraphDot::layer() const
+        {
+            return GL_DYNAMIC;
+        }
+
         void GraphDot::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
         {
             // Get graph
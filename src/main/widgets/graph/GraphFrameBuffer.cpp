@@ -73,10 +73,16 @@ namespace lsp
             bClear              = true;
             nRows               = 0;
             nCols               = 0;
+            nHead               = 0;
             pCalcColor          = &GraphFrameBuffer::calc_rainbow_color;
             fRGBA               = NULL;
             pfRGBA              = NULL;
             nCapacity           = 0;
+            vPalette            = NULL;
+            pPalette            = NULL;
+            fPalMin             = 0.0f;
+            fPalMax             = 0.0f;
+            bPalette            = false;
 
             pClass              = &metadata;
         }
@@ -99,9 +105,15 @@ namespace lsp
             if (pfRGBA != NULL)
                 lsp::free_aligned(pfRGBA);
 
+            if (pPalette != NULL)
+                lsp::free_aligned(pPalette);
+
             fRGBA               = NULL;
             pfRGBA              = NULL;
             nCapacity           = 0;
+            vPalette            = NULL;
+            pPalette            = NULL;
+            bPalette            = false;
         }
 
         status_t GraphFrameBuffer::init()
@@ -172,6 +184,7 @@ namespace lsp
             if (sColor.is(prop))
             {
                 bClear      = true;
+                bPalette    = false;
                 query_draw();
             }
             if (sFunction.is(prop))
@@ -189,12 +202,21 @@ namespace lsp
 
                 if (pCalcColor != func)
                 {
+                    pCalcColor  = func;
                     bClear      = true;
+                    bPalette    = false;
                     query_draw();
                 }
             }
         }
 
+        void GraphFrameBuffer::surface_created(ws::ISurface *s)
+        {
+            // The ring buffer of rows is lost, redraw all rows from the head
+            bClear      = true;
+            nHead       = 0;
+        }
+
         void GraphFrameBuffer::draw(ws::ISurface *s)
         {
             // Need to deploy new changes?
@@ -202,11 +224,15 @@ namespace lsp
             if (changes <= 0)
                 return;
 
-            // Allocate RGBA buffer
+            // Update the palette
+            if (!sync_palette())
+                return;
+
+            // Allocate buffer for palette indexes
             if (nCapacity != sData.stride())
             {
                 uint8_t *ptr    = NULL;
-                float *rgba     = lsp::alloc_aligned<float>(ptr, sData.stride() * 4, 0x40); // 4 components per dot
+                float *rgba     = lsp::alloc_aligned<float>(ptr, sData.stride(), 0x40);
                 if (rgba == NULL)
                     return;
                 if (pfRGBA != NULL)
@@ -221,21 +247,23 @@ namespace lsp
             if (xp == NULL)
                 return;
 
-            // Shift buffer
+            // The surface is used as a ring buffer of rows: instead of shifting the whole
+            // image, move the head backwards and overwrite the oldest rows with new data
             size_t stride   = s->stride();
-            ::memmove(&xp[stride * changes], xp, (sData.rows() - changes) * stride);
+            changes         = lsp_min(changes, nRows);
+            nHead           = (bClear) ? 0 : (nHead + nRows - changes) % nRows;
 
             // Draw dots
             uint32_t row    = sData.last();
 
-            for (size_t i=1; i<=changes; ++i, xp += stride)
+            for (size_t i=0; i<changes; ++i)
             {
-                const float *p = sData.row(row - i);
+                const float *p = sData.row(row - i - 1);
                 if (p == NULL)
                     continue;
 
-                (this->*pCalcColor)(fRGBA, p, nCols);
-                dsp::rgba_to_bgra32(xp, fRGBA, nCols);
+                size_t dst      = (nHead + i) % nRows;
+                map_colors(reinterpret_cast<uint32_t *>(&xp[dst * stride]), p, nCols);
             }
 
             s->end_direct();
@@ -245,6 +273,68 @@ namespace lsp
             sData.advance();
         }
 
+        bool GraphFrameBuffer::sync_palette()
+        {
+            float min       = lsp_min(sData.min(), sData.max());
+            float max       = lsp_max(sData.min(), sData.max());
+            if ((bPalette) && (fPalMin == min) && (fPalMax == max))
+                return true;
+
+            // Allocate palette
+            if (vPalette == NULL)
+            {
+                vPalette        = lsp::alloc_aligned<uint32_t>(pPalette, PALETTE_SIZE, 0x40);
+                if (vPalette == NULL)
+                    return false;
+            }
+
+            // Allocate temporary buffer for the values and their colors
+            uint8_t *ptr    = NULL;
+            float *v        = lsp::alloc_aligned<float>(ptr, PALETTE_SIZE * 5, 0x40);
+            if (v == NULL)
+                return false;
+            float *rgba     = &v[PALETTE_SIZE];
+
+            // Compute the color for each quantized value
+            float k         = (max - min) / float(PALETTE_SIZE - 1);
+            for (size_t i=0; i<PALETTE_SIZE; ++i)
+                v[i]            = min + k * i;
+            v[PALETTE_SIZE - 1] = max;
+
+            (this->*pCalcColor)(rgba, v, PALETTE_SIZE);
+            dsp::rgba_to_bgra32(vPalette, rgba, PALETTE_SIZE);
+
+            lsp::free_aligned(ptr);
+
+            fPalMin         = min;
+            fPalMax         = max;
+            bPalette        = true;
+
+            return true;
+        }
+
+        void GraphFrameBuffer::map_colors(uint32_t *dst, const float *v, size_t n)
+        {
+            // Compute palette indexes, the values are already limited to [min, max] range
+            float delta     = fPalMax - fPalMin;
+            float k         = (delta > 0.0f) ? float(PALETTE_SIZE - 1) / delta : 0.0f;
+            dsp::mul_k3(fRGBA, v, k, n);
+            dsp::add_k2(fRGBA, 0.5f - fPalMin * k, n);
+
+            // Gather colors from the palette
+            const uint32_t *pal = vPalette;
+            for (size_t i=0; i<n; ++i)
+            {
+                ssize_t idx     = fRGBA[i];
+                dst[i]          = pal[lsp_limit(idx, ssize_t(0), ssize_t(PALETTE_SIZE - 1))];
+            }
+        }
+
+        graph_layer_t GraphFrameBuffer::layer() const
+        {
+            return GL_DYNAMIC;
+        }
+
         void GraphFrameBuffer::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
         {
             // Check size
@@ -312,8 +402,55 @@ namespace lsp
                     break;
             }
 
-            // Draw the buffer
-            s->draw_rotate_alpha(pp, x, y, sx, sy, ra, sTransparency.get());
+            // Compute the displacement of one row and one column of the surface on the target
+            float rv[2], cv[2];
+            switch (sAngle.get() & 0x03)
+            {
+                case 1:  rv[0] = sx;    rv[1] = 0.0f;   cv[0] = 0.0f;   cv[1] = -sy;    break;
+                case 2:  rv[0] = 0.0f;  rv[1] = -sy;    cv[0] = -sx;    cv[1] = 0.0f;   break;
+                case 3:  rv[0] = -sx;   rv[1] = 0.0f;   cv[0] = 0.0f;   cv[1] = sy;     break;
+                default: rv[0] = 0.0f;  rv[1] = sy;     cv[0] = sx;     cv[1] = 0.0f;   break;
+            }
+
+            // Draw the ring buffer: the part starting at head goes first, the wrapped part follows it
+            ssize_t head    = lsp_min(nHead, nRows);
+            if (head <= 0)
+            {
+                s->draw_rotate_alpha(pp, x, y, sx, sy, ra, sTransparency.get());
+                return;
+            }
+
+            ssize_t split   = nRows - head;
+            draw_part(s, pp, x, y, sx, sy, ra, rv, cv, -head, split);
+            draw_part(s, pp, x, y, sx, sy, ra, rv, cv, split, nRows + split);
+        }
+
+        void GraphFrameBuffer::draw_part(ws::ISurface *s, ws::ISurface *pp,
+            float x, float y, float sx, float sy, float ra,
+            const float *rv, const float *cv, ssize_t first, ssize_t last)
+        {
+            // The surface is drawn with its first row placed at logical row 'first',
+            // only logical rows in range [max(first, 0), min(last, nRows)) are visible
+            ssize_t vfirst  = lsp_max(first, 0);
+            ssize_t vlast   = lsp_min(last, ssize_t(nRows));
+            if (vfirst >= vlast)
+                return;
+
+            // Compute clipping rectangle on the target surface
+            float x1        = x + rv[0] * vfirst;
+            float y1        = y + rv[1] * vfirst;
+            float x2        = x + rv[0] * vlast + cv[0] * nCols;
+            float y2        = y + rv[1] * vlast + cv[1] * nCols;
+            float cx        = roundf(lsp_min(x1, x2));
+            float cy        = roundf(lsp_min(y1, y2));
+            float cw        = roundf(lsp_max(x1, x2)) - cx;
+            float ch        = roundf(lsp_max(y1, y2)) - cy;
+            if ((cw <= 0.0f) || (ch <= 0.0f))
+                return;
+
+            s->clip_begin(cx, cy, cw, ch);
+            s->draw_rotate_alpha(pp, x + rv[0] * first, y + rv[1] * first, sx, sy, ra, sTransparency.get());
+            s->clip_end();
         }
 
         void GraphFrameBuffer::calc_rainbow_color(float *rgba, const float *v, size_t n)
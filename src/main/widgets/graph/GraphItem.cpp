@@ -82,6 +82,16 @@ namespace lsp
                 query_draw();
         }
 
+        void GraphItem::hide_widget()
+        {
+            Widget::hide_widget();
+
+            // Remove the item from the rendered layer of the graph
+            Graph *gr = graph();
+            if (gr != NULL)
+                gr->query_layer_draw(layer());
+        }
+
         Graph *GraphItem::graph()
         {
             return widget_cast<Graph>(pParent);
@@ -92,18 +102,23 @@ namespace lsp
             return false;
         }
 
+        graph_layer_t GraphItem::layer() const
+        {
+            return GL_STATIC;
+        }
+
         void GraphItem::query_draw(size_t flags)
         {
             Widget::query_draw(flags);
             if (!sVisibility.get())
                 return;
 
-            // Force graph to redraw it's surface
+            // Force graph to redraw the layer of the item
             if (flags & (REDRAW_SURFACE | REDRAW_CHILD))
             {
                 Graph *gr = graph();
                 if (gr != NULL)
-                    gr->query_draw(REDRAW_SURFACE);
+                    gr->query_layer_draw(layer());
             }
         }
     }
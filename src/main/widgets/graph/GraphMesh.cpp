@@ -22,6 +22,7 @@
 #include <lsp-plug.in/tk/tk.h>
 #include <lsp-plug.in/common/alloc.h>
 #include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/tk/helpers/graphics.h>
 #include <stdlib.h>
 #include <private/tk/style/BuiltinStyle.h>
 
@@ -41,6 +42,7 @@ namespace lsp
                 sColor.bind("color", this);
                 sFillColor.bind("fill.color", this);
                 sData.bind("data", this);
+                sSimplify.bind("simplify", this);
                 // Configure
                 sOrigin.set(0);
                 sXAxis.set(0);
@@ -50,6 +52,7 @@ namespace lsp
                 sColor.set("#00ff00");
                 sFillColor.set("#8800ff00");
                 sData.set_size(0);
+                sSimplify.set(false);
             LSP_TK_STYLE_IMPL_END
             LSP_TK_BUILTIN_STYLE(GraphMesh, "GraphMesh");
         }
@@ -65,10 +68,19 @@ namespace lsp
             sFill(&sProperties),
             sColor(&sProperties),
             sFillColor(&sProperties),
-            sData(&sProperties)
+            sData(&sProperties),
+            sSimplify(&sProperties)
         {
             vBuffer             = NULL;
             nCapacity           = 0;
+            nStride             = 0;
+            pXAxis              = NULL;
+            pYAxis              = NULL;
+            nXAxisId            = 0;
+            nYAxisId            = 0;
+            fOriginX            = 0.0f;
+            fOriginY            = 0.0f;
+            bCached             = false;
 
             pClass              = &metadata;
         }
@@ -94,6 +106,10 @@ namespace lsp
                 vBuffer         = NULL;
             }
             nCapacity       = 0;
+            nStride         = 0;
+            pXAxis          = NULL;
+            pYAxis          = NULL;
+            bCached         = false;
         }
 
         status_t GraphMesh::init()
@@ -111,6 +127,7 @@ namespace lsp
             sColor.bind("color", &sStyle);
             sFillColor.bind("fill.color", &sStyle);
             sData.bind("data", &sStyle);
+            sSimplify.bind("simplify", &sStyle);
 
 //            Style *sclass = style_class();
 //            if (sclass != NULL)
@@ -148,6 +165,13 @@ namespace lsp
                 query_draw();
             if (sData.is(prop))
                 query_draw();
+            if (sSimplify.is(prop))
+                query_draw();
+        }
+
+        graph_layer_t GraphMesh::layer() const
+        {
+            return GL_DYNAMIC;
         }
 
         void GraphMesh::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
@@ -171,8 +195,14 @@ namespace lsp
             float cx = 0.0f, cy = 0.0f;
             cv->origin(sOrigin.get(), &cx, &cy);
 
-            // Ensure that we have enough buffer size
-            size_t cap_size     = align_size(sData.size() * 2, DEFAULT_ALIGN);
+            size_t vec_size     = sData.size();
+            if (vec_size <= 0)
+                return;
+
+            // Ensure that we have enough buffer size: the contribution of the X data and of the Y data
+            // to the coordinates of dots are stored separately to allow partial updates
+            size_t stride       = align_size(vec_size, DEFAULT_ALIGN);
+            size_t cap_size     = stride * 6;
             if (nCapacity < cap_size)
             {
                 float *buf          = static_cast<float *>(realloc(vBuffer, cap_size * sizeof(float)));
@@ -180,26 +210,75 @@ namespace lsp
                     return;
                 vBuffer             = buf;
                 nCapacity           = cap_size;
+                bCached             = false;
+            }
+            if (nStride != stride)
+            {
+                nStride             = stride;
+                bCached             = false;
             }
 
-            // Initialize dimensions as zeros
-            size_t vec_size     = sData.size();
-            float *x_vec        = &vBuffer[0];
-            float *y_vec        = &x_vec[vec_size];
-            dsp::fill(x_vec, cx, vec_size);
-            dsp::fill(y_vec, cy, vec_size);
+            float *xx_vec       = &vBuffer[0];
+            float *xy_vec       = &xx_vec[stride];
+            float *yx_vec       = &xy_vec[stride];
+            float *yy_vec       = &yx_vec[stride];
+            float *x_vec        = &yy_vec[stride];
+            float *y_vec        = &x_vec[stride];
 
-            // Calculate coordinates for each dot
+            // Get axes and their transforms
             GraphAxis *xaxis    = cv->axis(sXAxis.get());
             GraphAxis *yaxis    = cv->axis(sYAxis.get());
             if ((xaxis == NULL) || (yaxis == NULL))
                 return;
 
-            if (!xaxis->apply(x_vec, y_vec, sData.x(), vec_size))
-                return;
-            if (!yaxis->apply(x_vec, y_vec, sData.y(), vec_size))
+            size_t xid          = xaxis->transform_id();
+            size_t yid          = yaxis->transform_id();
+            if ((xid == 0) || (yid == 0))
                 return;
 
+            // Re-compute only the changed ranges if the transforms did not change
+            size_t first = 0, count = vec_size;
+            bool x_full         = (!bCached) || (pXAxis != xaxis) || (nXAxisId != xid) ||
+                                  (fOriginX != cx) || (fOriginY != cy);
+            bool y_full         = (!bCached) || (pYAxis != yaxis) || (nYAxisId != yid);
+            bCached             = false;
+
+            if ((x_full) || (sData.x_changes(&first, &count)))
+            {
+                dsp::fill(&xx_vec[first], cx, count);
+                dsp::fill(&xy_vec[first], cy, count);
+                if (!xaxis->apply(&xx_vec[first], &xy_vec[first], &sData.x()[first], count))
+                    return;
+            }
+
+            first               = 0;
+            count               = vec_size;
+            if ((y_full) || (sData.y_changes(&first, &count)))
+            {
+                dsp::fill_zero(&yx_vec[first], count);
+                dsp::fill_zero(&yy_vec[first], count);
+                if (!yaxis->apply(&yx_vec[first], &yy_vec[first], &sData.y()[first], count))
+                    return;
+            }
+
+            // Store the state of the cached transform
+            pXAxis              = xaxis;
+            pYAxis              = yaxis;
+            nXAxisId            = xid;
+            nYAxisId            = yid;
+            fOriginX            = cx;
+            fOriginY            = cy;
+            bCached             = true;
+            sData.advance();
+
+            // Calculate coordinates for each dot
+            dsp::add3(x_vec, xx_vec, yx_vec, vec_size);
+            dsp::add3(y_vec, xy_vec, yy_vec, vec_size);
+
+            // Reduce the number of dots to the resolution of the canvas
+            if (sSimplify.get())
+                vec_size            = decimate2d(x_vec, y_vec, vec_size);
+
             // Now we have dots in x_vec[] and y_vec[]
             bool aa = s->set_antialiasing(sSmooth.get());
             if (sFill.get())
@@ -0,0 +1,377 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/tk/helpers/graphics.h>
+#include <private/tk/style/BuiltinStyle.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        namespace style
+        {
+            LSP_TK_STYLE_IMPL_BEGIN(GraphMeshSet, GraphItem)
+                // Bind
+                sOrigin.bind("origin", this);
+                sXAxis.bind("haxis", this);
+                sYAxis.bind("vaxis", this);
+                sWidth.bind("width", this);
+                sFill.bind("fill", this);
+                sSimplify.bind("simplify", this);
+                // Configure
+                sOrigin.set(0);
+                sXAxis.set(0);
+                sYAxis.set(1);
+                sWidth.set(3);
+                sFill.set(false);
+                sSimplify.set(false);
+            LSP_TK_STYLE_IMPL_END
+            LSP_TK_BUILTIN_STYLE(GraphMeshSet, "GraphMeshSet");
+
+            LSP_TK_STYLE_IMPL_BEGIN(GraphMeshSeries, Style)
+                // Bind
+                sVisibility.bind("visible", this);
+                sColor.bind("color", this);
+                sFillColor.bind("fill.color", this);
+                // Configure
+                sVisibility.set(true);
+                sColor.set("#00ff00");
+                sFillColor.set("#8800ff00");
+            LSP_TK_STYLE_IMPL_END
+            LSP_TK_BUILTIN_STYLE(GraphMeshSeries, "GraphMeshSeries");
+        }
+
+        //---------------------------------------------------------------------
+        GraphMeshSeries::GraphMeshSeries(Schema *schema, prop::Listener *listener):
+            sStyle(schema),
+            sVisibility(listener),
+            sColor(listener),
+            sFillColor(listener),
+            sData(listener)
+        {
+        }
+
+        status_t GraphMeshSeries::init()
+        {
+            status_t res = sStyle.init();
+            if (res != STATUS_OK)
+                return res;
+
+            sVisibility.bind("visible", &sStyle);
+            sColor.bind("color", &sStyle);
+            sFillColor.bind("fill.color", &sStyle);
+
+            Style *sclass = sStyle.schema()->get("GraphMeshSeries");
+            if (sclass != NULL)
+                res = sStyle.add_parent(sclass);
+
+            return res;
+        }
+
+        bool GraphMeshSeries::is(Property *prop) const
+        {
+            return sVisibility.is(prop) ||
+                    sColor.is(prop) ||
+                    sFillColor.is(prop) ||
+                    sData.is(prop);
+        }
+
+        bool GraphMeshSeries::drawable() const
+        {
+            return (sVisibility.get()) && (sData.valid()) && (sData.size() > 0);
+        }
+
+        //---------------------------------------------------------------------
+        const w_class_t GraphMeshSet::metadata          = { "GraphMeshSet", &GraphItem::metadata };
+
+        GraphMeshSet::GraphMeshSet(Display *dpy):
+            GraphItem(dpy),
+            sOrigin(&sProperties),
+            sXAxis(&sProperties),
+            sYAxis(&sProperties),
+            sWidth(&sProperties),
+            sFill(&sProperties),
+            sSimplify(&sProperties)
+        {
+            pClass              = &metadata;
+        }
+
+        GraphMeshSet::~GraphMeshSet()
+        {
+            nFlags     |= FINALIZED;
+            do_destroy();
+        }
+
+        void GraphMeshSet::destroy()
+        {
+            nFlags     |= FINALIZED;
+            GraphItem::destroy();
+            do_destroy();
+        }
+
+        void GraphMeshSet::do_destroy()
+        {
+            for (size_t i=0, n=vSeries.size(); i<n; ++i)
+            {
+                GraphMeshSeries *gs = vSeries.uget(i);
+                if (gs != NULL)
+                    delete gs;
+            }
+
+            vSeries.flush();
+            vXPtr.flush();
+            vYPtr.flush();
+            vXData.flush();
+            vYData.flush();
+            sBuffer.flush();
+        }
+
+        status_t GraphMeshSet::init()
+        {
+            status_t res        = GraphItem::init();
+            if (res != STATUS_OK)
+                return res;
+
+            // Init style
+            sOrigin.bind("origin", &sStyle);
+            sXAxis.bind("haxis", &sStyle);
+            sYAxis.bind("vaxis", &sStyle);
+            sWidth.bind("width", &sStyle);
+            sFill.bind("fill", &sStyle);
+            sSimplify.bind("simplify", &sStyle);
+
+            return STATUS_OK;
+        }
+
+        void GraphMeshSet::property_changed(Property *prop)
+        {
+            GraphItem::property_changed(prop);
+
+            if (sOrigin.is(prop))
+                query_draw();
+            if (sXAxis.is(prop))
+                query_draw();
+            if (sYAxis.is(prop))
+                query_draw();
+            if (sWidth.is(prop))
+                query_draw();
+            if (sFill.is(prop))
+                query_draw();
+            if (sSimplify.is(prop))
+                query_draw();
+
+            // Check properties of series
+            for (size_t i=0, n=vSeries.size(); i<n; ++i)
+            {
+                GraphMeshSeries *gs = vSeries.uget(i);
+                if ((gs != NULL) && (gs->is(prop)))
+                {
+                    query_draw();
+                    break;
+                }
+            }
+        }
+
+        GraphMeshSeries *GraphMeshSet::add_series()
+        {
+            GraphMeshSeries *gs = new GraphMeshSeries(pDisplay->schema(), &sProperties);
+            if (gs == NULL)
+                return NULL;
+
+            if ((gs->init() != STATUS_OK) || (!vSeries.add(gs)))
+            {
+                delete gs;
+                return NULL;
+            }
+
+            query_draw();
+            return gs;
+        }
+
+        status_t GraphMeshSet::remove_series(size_t index)
+        {
+            GraphMeshSeries *gs = vSeries.get(index);
+            if (gs == NULL)
+                return STATUS_INVALID_VALUE;
+            if (!vSeries.remove(index))
+                return STATUS_UNKNOWN_ERR;
+
+            delete gs;
+            query_draw();
+
+            return STATUS_OK;
+        }
+
+        void GraphMeshSet::clear_series()
+        {
+            for (size_t i=0, n=vSeries.size(); i<n; ++i)
+            {
+                GraphMeshSeries *gs = vSeries.uget(i);
+                if (gs != NULL)
+                    delete gs;
+            }
+            vSeries.flush();
+
+            query_draw();
+        }
+
+        graph_layer_t GraphMeshSet::layer() const
+        {
+            return GL_DYNAMIC;
+        }
+
+        void GraphMeshSet::clear_batch()
+        {
+            vXPtr.clear();
+            vYPtr.clear();
+            vXData.clear();
+            vYData.clear();
+        }
+
+        bool GraphMeshSet::apply_batch(GraphAxis *xaxis, GraphAxis *yaxis, size_t count)
+        {
+            size_t n    = vXPtr.size();
+            if (n <= 0)
+                return true;
+
+            bool res    = (xaxis->apply(vXPtr.array(), vYPtr.array(), vXData.array(), count, n)) &&
+                          (yaxis->apply(vXPtr.array(), vYPtr.array(), vYData.array(), count, n));
+            clear_batch();
+
+            return res;
+        }
+
+        void GraphMeshSet::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
+        {
+            // Get graph and axes, they are shared between all series
+            Graph *cv = graph();
+            if (cv == NULL)
+                return;
+
+            GraphAxis *xaxis    = cv->axis(sXAxis.get());
+            GraphAxis *yaxis    = cv->axis(sYAxis.get());
+            if ((xaxis == NULL) || (yaxis == NULL))
+                return;
+
+            float cx = 0.0f, cy = 0.0f;
+            cv->origin(sOrigin.get(), &cx, &cy);
+
+            // Estimate the size of buffer for all series
+            size_t total        = 0;
+            for (size_t i=0, n=vSeries.size(); i<n; ++i)
+            {
+                GraphMeshSeries *gs = vSeries.uget(i);
+                if ((gs != NULL) && (gs->drawable()))
+                    total              += align_size(gs->sData.size(), DEFAULT_ALIGN) * 2;
+            }
+            if (total <= 0)
+                return;
+
+            float *buf          = sBuffer.get(total);
+            if (buf == NULL)
+                return;
+
+            // Transform all series, series of the same size are transformed in one batch
+            float *ptr          = buf;
+            size_t batch        = 0;
+            for (size_t i=0, n=vSeries.size(); i<n; ++i)
+            {
+                GraphMeshSeries *gs = vSeries.uget(i);
+                if ((gs == NULL) || (!gs->drawable()))
+                    continue;
+
+                size_t count        = gs->sData.size();
+                size_t stride       = align_size(count, DEFAULT_ALIGN);
+                float *x_vec        = ptr;
+                float *y_vec        = &ptr[stride];
+                ptr                += stride * 2;
+
+                if ((batch != count) && (!apply_batch(xaxis, yaxis, batch)))
+                    return;
+
+                dsp::fill(x_vec, cx, count);
+                dsp::fill(y_vec, cy, count);
+
+                float **xp          = vXPtr.add();
+                float **yp          = vYPtr.add();
+                const float **xd    = vXData.add();
+                const float **yd    = vYData.add();
+                if ((xp == NULL) || (yp == NULL) || (xd == NULL) || (yd == NULL))
+                {
+                    clear_batch();
+                    return;
+                }
+
+                *xp                 = x_vec;
+                *yp                 = y_vec;
+                *xd                 = gs->sData.x();
+                *yd                 = gs->sData.y();
+                batch               = count;
+            }
+            if (!apply_batch(xaxis, yaxis, batch))
+                return;
+
+            // Draw all series with the same surface settings
+            float scaling       = lsp_max(0.0f, sScaling.get());
+            float width         = (sWidth.get() > 0) ? lsp_max(1.0f, sWidth.get() * scaling) : 0.0f;
+            float bright        = sBrightness.get();
+            bool fill           = sFill.get();
+            bool simplify       = sSimplify.get();
+            lsp::Color line, fcolor;
+
+            bool aa             = s->set_antialiasing(sSmooth.get());
+
+            ptr                 = buf;
+            for (size_t i=0, n=vSeries.size(); i<n; ++i)
+            {
+                GraphMeshSeries *gs = vSeries.uget(i);
+                if ((gs == NULL) || (!gs->drawable()))
+                    continue;
+
+                size_t count        = gs->sData.size();
+                size_t stride       = align_size(count, DEFAULT_ALIGN);
+                float *x_vec        = ptr;
+                float *y_vec        = &ptr[stride];
+                ptr                += stride * 2;
+
+                if (simplify)
+                    count               = decimate2d(x_vec, y_vec, count);
+
+                line.copy(gs->sColor);
+                line.scale_lightness(bright);
+
+                if (fill)
+                {
+                    fcolor.copy(gs->sFillColor);
+                    fcolor.scale_lightness(bright);
+                    s->draw_poly(fcolor, line, width, x_vec, y_vec, count);
+                }
+                else if (width > 0)
+                    s->wire_poly(line, width, x_vec, y_vec, count);
+            }
+
+            s->set_antialiasing(aa);
+        }
+    }
+}
@@ -120,12 +120,51 @@ namespace lsp
             sLoop(&sProperties),
             sText(&sProperties)
         {
-            pClass      = &metadata;
+            pAtlas          = NULL;
+            nGlyphs         = 0;
+            nAtlasRows      = 0;
+            nCellWidth      = 0;
+            nCellHeight     = 0;
+            fAtlasScaling   = 0.0f;
+            nAtlasOn        = 0;
+            nAtlasOff       = 0;
+            for (size_t i=0; i<ATLAS_STATES; ++i)
+                vSlots[i]       = -1;
+
+            pClass          = &metadata;
         }
         
         Indicator::~Indicator()
         {
             nFlags     |= FINALIZED;
+            drop_glyphs();
+        }
+
+        void Indicator::destroy()
+        {
+            nFlags     |= FINALIZED;
+            Widget::destroy();
+            drop_glyphs();
+        }
+
+        void Indicator::hide_widget()
+        {
+            Widget::hide_widget();
+            drop_glyphs();
+        }
+
+        void Indicator::drop_glyphs()
+        {
+            if (pAtlas != NULL)
+            {
+                pAtlas->destroy();
+                delete pAtlas;
+                pAtlas      = NULL;
+            }
+            for (size_t i=0; i<ATLAS_STATES; ++i)
+                vSlots[i]   = -1;
+            nGlyphs     = 0;
+            nAtlasRows  = 0;
         }
 
         status_t Indicator::init()
@@ -179,6 +218,79 @@ namespace lsp
             }
         }
 
+        ssize_t Indicator::get_glyph(ws::ISurface *s, size_t state, const lsp::Color &on, const lsp::Color &off)
+        {
+            // Lookup for already rendered glyph
+            if (state >= ATLAS_STATES)
+                return -1;
+            if (vSlots[state] >= 0)
+                return vSlots[state];
+            size_t n            = nGlyphs;
+
+            // Grow the atlas if there is no space for the glyph
+            if (n >= nAtlasRows * ATLAS_COLUMNS)
+            {
+                size_t rows         = lsp_max(nAtlasRows << 1, size_t(2));
+                ws::ISurface *atlas = s->create(nCellWidth * ATLAS_COLUMNS, nCellHeight * rows);
+                if (atlas == NULL)
+                    return -1;
+
+                // Copy previously rendered glyphs
+                if (pAtlas != NULL)
+                {
+                    atlas->draw(pAtlas, 0, 0);
+                    pAtlas->destroy();
+                    delete pAtlas;
+                }
+
+                pAtlas              = atlas;
+                nAtlasRows          = rows;
+            }
+
+            // Render the glyph, the glyph is drawn at the same offset within the cell
+            // as it is drawn within the cell of the indicator
+            float scaling       = lsp_max(0.0f, sScaling.get());
+            float x             = (n % ATLAS_COLUMNS) * nCellWidth;
+            float y             = (n / ATLAS_COLUMNS) * nCellHeight;
+
+            bool aa = pAtlas->set_antialiasing(true);
+            draw_digit(pAtlas, x + scaling, y + scaling, state, on, off);
+            pAtlas->set_antialiasing(aa);
+
+            vSlots[state]       = n;
+            nGlyphs             = n + 1;
+
+            return n;
+        }
+
+        void Indicator::draw_glyph(ws::ISurface *s, size_t col, size_t row, size_t state, const lsp::Color &on, const lsp::Color &off)
+        {
+            float scaling   = lsp_max(0.0f, sScaling.get());
+            float fx        = col * 16 * scaling;
+            float fy        = row * 20 * scaling;
+            ssize_t x       = floorf(fx);
+            ssize_t y       = floorf(fy);
+
+            // Glyphs in the atlas are aligned to the pixel grid, so only cells that start
+            // at the pixel boundary can be copied, other cells are drawn directly
+            ssize_t glyph   = ((x == fx) && (y == fy)) ? get_glyph(s, state, on, off) : -1;
+            if (glyph < 0)
+            {
+                bool aa = s->set_antialiasing(true);
+                draw_digit(s, (col*16 + 1) * scaling, (20*row + 1) * scaling, state, on, off);
+                s->set_antialiasing(aa);
+                return;
+            }
+
+            // Copy the glyph from the atlas
+            ssize_t ax      = (glyph % ATLAS_COLUMNS) * nCellWidth;
+            ssize_t ay      = (glyph / ATLAS_COLUMNS) * nCellHeight;
+
+            s->clip_begin(x, y, nCellWidth, nCellHeight);
+                s->draw(pAtlas, x - ax, y - ay);
+            s->clip_end();
+        }
+
         void Indicator::size_request(ws::size_limit_t *r)
         {
             float scaling   = lsp_max(0.0f, sScaling.get());
@@ -237,7 +349,16 @@ namespace lsp
             // Draw glass
             s->clear(color);
 
-            bool aa = s->set_antialiasing(true);
+            // Invalidate the atlas if glyph parameters have changed
+            if ((fAtlasScaling != scaling) || (nAtlasOn != on.rgba32()) || (nAtlasOff != off.rgba32()))
+            {
+                drop_glyphs();
+                fAtlasScaling   = scaling;
+                nAtlasOn        = on.rgba32();
+                nAtlasOff       = off.rgba32();
+                nCellWidth      = ceilf(16 * scaling);
+                nCellHeight     = ceilf(20 * scaling);
+            }
 
             LSPString text;
             sText.format(&text);
@@ -301,16 +422,14 @@ namespace lsp
                 if (ch == '\n') // Need to fill up to end-of-line
                 {
                     for ( ; col < cols; ++col, ++offset)
-                        draw_digit(s, (col*16 + 1) * scaling, (20*row + 1) * scaling, state, on, off);
+                        draw_glyph(s, col, row, state, on, off);
                 }
                 else
                 {
-                    draw_digit(s, (col*16 + 1) * scaling, (20*row + 1) * scaling, state, on, off);
+                    draw_glyph(s, col, row, state, on, off);
                     ++offset;
                 }
             }
-
-            s->set_antialiasing(aa);
         }
 
     } /* namespace tk */
@@ -21,6 +21,7 @@
 
 #include <lsp-plug.in/tk/tk.h>
 #include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/string.h>
 #include <lsp-plug.in/common/debug.h>
 #include <private/tk/style/BuiltinStyle.h>
 
@@ -337,75 +338,60 @@ namespace lsp
             return STATUS_OK;
         }
 
-        void Knob::draw(ws::ISurface *s)
+        void Knob::draw_face(ws::ISurface *s, size_t layer)
         {
             float scaling       = lsp_max(0.0f, sScaling.get());
             float bright        = sBrightness.get();
-            float value         = sValue.get_normalized();
-            float balance       = sValue.get_normalized(sBalance.get());
 
             // Calculate knob parameters
             ssize_t c_x         = (sSize.nWidth >> 1);
             ssize_t c_y         = (sSize.nHeight >> 1);
             size_t xr           = lsp_min(sSize.nWidth, sSize.nHeight) >> 1;
-            size_t chamfer      = lsp_max(1, scaling * 3.0f);
-            size_t hole         = lsp_max(1, scaling);
             size_t gap          = lsp_max(1, scaling);
             size_t scale        = lsp_max(0, sScale.get() * scaling);
 
             // Prepare the color palette
-            lsp::Color scol(sScaleColor);
             lsp::Color sdcol(sScaleColor);
             lsp::Color hcol(sHoleColor);
             lsp::Color bg_color(sBgColor);
-            lsp::Color cap(sColor);
-            lsp::Color tip(sTipColor);
 
-            scol.scale_lightness(bright);
             sdcol.scale_lightness(0.75f * bright);
-            cap.scale_lightness(bright);
-            tip.scale_lightness(bright);
 
-            // Draw background
-            s->clear(bg_color);
             bool aa = s->set_antialiasing(true);
 
             size_t nsectors;
-            float delta, base, v_angle1, v_angle2;
+            float delta, base;
             if (sCycling.get())
             {
                 nsectors      = 24;
                 delta         = 2.0f * M_PI;
-                base          = 1.5f * M_PI + balance * delta;
-                v_angle2      = base;
-                v_angle1      = base + value * delta;
+                base          = 1.5f * M_PI + sValue.get_normalized(sBalance.get()) * delta;
             }
             else
             {
                 nsectors      = 20;
                 delta         = 5.0f * M_PI / 3.0f;
                 base          = 2.0f * M_PI / 3.0f;
-                v_angle1      = base + value * delta;
-                v_angle2      = base + balance * delta;
             }
 
-            // Draw scale
-            if (scale > 0)
+            // Draw the base layer: the scale below the value arc
+            if (layer == FACE_BASE)
             {
-                if (sCycling.get())
-                {
-                    s->fill_circle(c_x, c_y, xr, sdcol);
-                    s->fill_sector(c_x, c_y, xr, v_angle2, v_angle1, scol);
-                }
-                else
+                if (scale > 0)
                 {
-                    s->fill_sector(c_x, c_y, xr, base, base + delta, sdcol);
-                    if (value < balance)
-                        s->fill_sector(c_x, c_y, xr, v_angle1, v_angle2, scol);
+                    if (sCycling.get())
+                        s->fill_circle(c_x, c_y, xr, sdcol);
                     else
-                        s->fill_sector(c_x, c_y, xr, v_angle2, v_angle1, scol);
+                        s->fill_sector(c_x, c_y, xr, base, base + delta, sdcol);
                 }
 
+                s->set_antialiasing(aa);
+                return;
+            }
+
+            // Draw the overlay layer: ticks and hole above the value arc
+            if (scale > 0)
+            {
                 // Draw scales: overall 10 segments separated by 2 sub-segments
                 float r1    = xr + 1;
                 float r2    = xr - scale * 0.5f;
@@ -428,9 +414,113 @@ namespace lsp
 
             // Draw hole
             s->fill_circle(c_x, c_y, xr, hcol);
+
+            s->set_antialiasing(aa);
+        }
+
+        void Knob::draw_face_cached(ws::ISurface *s, size_t layer)
+        {
+            // Form the key that identifies the face
+            face_key_t key;
+            ::memset(&key, 0, sizeof(key));
+            key.nLayer      = layer;
+            key.nWidth      = sSize.nWidth;
+            key.nHeight     = sSize.nHeight;
+            key.fScaling    = lsp_max(0.0f, sScaling.get());
+            key.fBright     = sBrightness.get();
+            key.fScale      = sScale.get();
+            key.nScaleColor = sScaleColor.rgba32();
+            key.nHoleColor  = sHoleColor.rgba32();
+            key.nBgColor    = sBgColor.rgba32();
+            key.bCycling    = (sCycling.get()) ? 1 : 0;
+            key.fBalance    = (sCycling.get()) ? sValue.get_normalized(sBalance.get()) : 0.0f;
+
+            // Lookup for the face shared between knobs, render it if not present
+            SurfaceCache *cache = pDisplay->surface_cache();
+            ws::ISurface *face  = cache->get(&key, sizeof(key));
+            if (face == NULL)
+            {
+                if ((face = s->create(sSize.nWidth, sSize.nHeight)) != NULL)
+                {
+                    draw_face(face, layer);
+                    if (cache->put(&key, sizeof(key), face) != STATUS_OK)
+                        face            = NULL;
+                }
+            }
+
+            // Draw the face
+            if (face != NULL)
+                s->draw(face, 0, 0);
+            else
+                draw_face(s, layer);
+        }
+
+        void Knob::draw(ws::ISurface *s)
+        {
+            float scaling       = lsp_max(0.0f, sScaling.get());
+            float bright        = sBrightness.get();
+            float value         = sValue.get_normalized();
+            float balance       = sValue.get_normalized(sBalance.get());
+
+            // Calculate knob parameters
+            ssize_t c_x         = (sSize.nWidth >> 1);
+            ssize_t c_y         = (sSize.nHeight >> 1);
+            size_t xr           = lsp_min(sSize.nWidth, sSize.nHeight) >> 1;
+            size_t chamfer      = lsp_max(1, scaling * 3.0f);
+            size_t hole         = lsp_max(1, scaling);
+            size_t gap          = lsp_max(1, scaling);
+            size_t scale        = lsp_max(0, sScale.get() * scaling);
+
+            // Prepare the color palette
+            lsp::Color scol(sScaleColor);
+            lsp::Color hcol(sHoleColor);
+            lsp::Color bg_color(sBgColor);
+            lsp::Color tip(sTipColor);
+            lsp::Color cap(sColor);
+            lsp::Color sdcol;
+
+            scol.scale_lightness(bright);
+            tip.scale_lightness(bright);
+            cap.scale_lightness(bright);
+
+            // Draw background and the static part of the scale
+            s->clear(bg_color);
+            if (scale > 0)
+                draw_face_cached(s, FACE_BASE);
+
+            bool aa = s->set_antialiasing(true);
+
+            float delta, base, v_angle1, v_angle2;
+            if (sCycling.get())
+            {
+                delta         = 2.0f * M_PI;
+                base          = 1.5f * M_PI + balance * delta;
+                v_angle2      = base;
+                v_angle1      = base + value * delta;
+            }
+            else
+            {
+                delta         = 5.0f * M_PI / 3.0f;
+                base          = 2.0f * M_PI / 3.0f;
+                v_angle1      = base + value * delta;
+                v_angle2      = base + balance * delta;
+            }
+
+            // Draw the value arc
+            if (scale > 0)
+            {
+                if ((sCycling.get()) || (value >= balance))
+                    s->fill_sector(c_x, c_y, xr, v_angle2, v_angle1, scol);
+                else
+                    s->fill_sector(c_x, c_y, xr, v_angle1, v_angle2, scol);
+                xr             -= (scale + gap);
+            }
+
+            // Draw ticks and hole
+            draw_face_cached(s, FACE_OVERLAY);
             xr -= hole;
 
-            // Draw knob
+            // Draw knob, each ring of the cap covers the tip drawn on the previous one
             float f_sin = sinf(v_angle1), f_cos = cosf(v_angle1);
 
             for (size_t i=0; i<=chamfer; ++i, --xr)
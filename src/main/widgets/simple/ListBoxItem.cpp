@@ -56,6 +56,10 @@ namespace lsp
             sTextColor(&sProperties),
             sTextSelectedColor(&sProperties)
         {
+            nTextWidth      = 0;
+            nTextHeight     = 0;
+            nTextSerial     = 0;
+
             pClass = &metadata;
         }
         
@@ -81,7 +85,10 @@ namespace lsp
         void ListBoxItem::property_changed(Property *prop)
         {
             if (sText.is(prop))
+            {
+                nTextSerial     = 0;
                 query_resize();
+            }
             if (sBgSelectedColor.is(prop))
                 query_draw();
             if (sTextColor.is(prop))
@@ -176,17 +176,18 @@ namespace lsp
             if ((samples <= 0) || (r->nWidth <= 1) || (r->nHeight <= 1))
                 return;
 
-            // Init decimation buffer
+            // Init decimation buffer, when the number of samples is greater than the width,
+            // draw the envelope formed by maximums and minimums of each column
             ssize_t n_draw      = lsp_min(ssize_t(samples), r->nWidth);
-            size_t n_points     = n_draw + 2;
+            bool envelope       = ssize_t(samples) > r->nWidth;
+            size_t n_points     = (envelope) ? n_draw * 2 : n_draw + 2;
             size_t n_decim      = lsp::align_size(n_points, 16); // 2 additional points at start and end
 
-            // Try to allocate memory
-            uint8_t *data       = NULL;
-            float *x            = lsp::alloc_aligned<float>(data, n_decim * 2);
-            float *y            = &x[n_decim];
+            // Obtain the persistent buffer, it grows only when the width increases
+            float *x            = sBuffer.get(n_decim * 2);
             if (x == NULL)
                 return;
+            float *y            = &x[n_decim];
 
             // Form the x and y values
             float border        = (sWaveBorder.get() > 0) ? lsp_max(1.0f, sWaveBorder.get() * scaling) : 0.0f;
@@ -195,16 +196,36 @@ namespace lsp
             float ky            = -0.5f * (r->nHeight - border);
             float sy            = r->nTop + r->nHeight * 0.5f;
 
-            x[0]                = -1.0f;
-            y[0]                = sy;
-            x[n_points-1]       = r->nWidth;
-            y[n_points-1]       = sy;
-
-            for (ssize_t i=1; i <= n_draw; ++i)
+            if (envelope)
             {
-                ssize_t xx          = i - 1;
-                x[i]                = xx * dx;
-                y[i]                = sy + ky * vSamples.get(ssize_t(xx * kx));
+                // Use the peak pyramid to compute the range of samples of each column
+                float vmin, vmax;
+                for (ssize_t i=0; i < n_draw; ++i)
+                {
+                    size_t first        = i * kx;
+                    size_t last         = lsp_max(first + 1, size_t((i + 1) * kx));
+                    if (!vSamples.peaks(&vmin, &vmax, first, last - first))
+                        vmin = vmax = 0.0f;
+
+                    x[i]                = i;
+                    y[i]                = sy + ky * vmax;
+                    x[n_points - i - 1] = i;
+                    y[n_points - i - 1] = sy + ky * vmin;
+                }
+            }
+            else
+            {
+                x[0]                = -1.0f;
+                y[0]                = sy;
+                x[n_points-1]       = r->nWidth;
+                y[n_points-1]       = sy;
+
+                for (ssize_t i=1; i <= n_draw; ++i)
+                {
+                    ssize_t xx          = i - 1;
+                    x[i]                = xx * dx;
+                    y[i]                = sy + ky * vSamples.get(ssize_t(xx * kx));
+                }
             }
 
             // Draw the poly
@@ -216,9 +237,6 @@ namespace lsp
             bool aa             = s->set_antialiasing(true);
             s->draw_poly(fill, wire, border, x, y, n_points);
             s->set_antialiasing(aa);
-
-            // Free allocated data
-            lsp::free_aligned(data);
         }
 
         void AudioChannel::draw_fades(const ws::rectangle_t *r, ws::ISurface *s, size_t samples, float scaling, float bright)
@@ -444,12 +444,11 @@ namespace lsp
             size_t n_points     = n_draw + 2;
             size_t n_decim      = lsp::align_size(n_points, 16); // 2 additional points at start and end
 
-            // Try to allocate memory
-            uint8_t *data       = NULL;
-            float *x            = lsp::alloc_aligned<float>(data, n_decim * 2);
-            float *y            = &x[n_decim];
+            // Use the persistent buffer of the channel
+            float *x            = c->sBuffer.get(n_decim * 2);
             if (x == NULL)
                 return;
+            float *y            = &x[n_decim];
 
             // Form the x and y values
             FloatArray *vsamp   = &c->vSamples;
@@ -480,9 +479,6 @@ namespace lsp
             bool aa             = s->set_antialiasing(true);
             s->draw_poly(fill, wire, border, x, y, n_points);
             s->set_antialiasing(aa);
-
-            // Free allocated data
-            lsp::free_aligned(data);
         }
 
         void AudioSample::draw_fades1(const ws::rectangle_t *r, ws::ISurface *s, AudioChannel *c, size_t samples)
@@ -573,12 +569,11 @@ namespace lsp
             size_t n_points     = n_draw + 2;
             size_t n_decim      = lsp::align_size(n_points, 16); // 2 additional points at start and end
 
-            // Try to allocate memory
-            uint8_t *data       = NULL;
-            float *x            = lsp::alloc_aligned<float>(data, n_decim * 2);
-            float *y            = &x[n_decim];
+            // Use the persistent buffer of the channel
+            float *x            = c->sBuffer.get(n_decim * 2);
             if (x == NULL)
                 return;
+            float *y            = &x[n_decim];
 
             bool aa             = s->set_antialiasing(true);
 
@@ -609,9 +604,7 @@ namespace lsp
             wire.scale_lightness(bright);
             s->draw_poly(fill, wire, border, x, y, n_points);
 
-            // Free allocated data
             s->set_antialiasing(aa);
-            lsp::free_aligned(data);
         }
 
         void AudioSample::draw_fades2(const ws::rectangle_t *r, ws::ISurface *s, AudioChannel *c, size_t samples, bool down)
@@ -124,12 +124,54 @@ namespace lsp
             sAAll.nWidth    = 0;
             sAAll.nHeight   = 0;
 
+            pLit            = NULL;
+            pUnlit          = NULL;
+            nStripWidth     = 0;
+            nStripHeight    = 0;
+            nStripAngle     = 0;
+            fStripScaling   = 0.0f;
+            fStripBright    = 0.0f;
+            fStripMin       = 0.0f;
+            fStripMax       = 0.0f;
+            bStrips         = false;
+
             pClass          = &metadata;
         }
 
         LedMeterChannel::~LedMeterChannel()
         {
             nFlags     |= FINALIZED;
+            drop_strips();
+        }
+
+        void LedMeterChannel::destroy()
+        {
+            nFlags     |= FINALIZED;
+            Widget::destroy();
+            drop_strips();
+        }
+
+        void LedMeterChannel::drop_strips()
+        {
+            if (pLit != NULL)
+            {
+                pLit->destroy();
+                delete pLit;
+                pLit        = NULL;
+            }
+            if (pUnlit != NULL)
+            {
+                pUnlit->destroy();
+                delete pUnlit;
+                pUnlit      = NULL;
+            }
+            bStrips     = false;
+        }
+
+        void LedMeterChannel::hide_widget()
+        {
+            Widget::hide_widget();
+            drop_strips();
         }
 
         status_t LedMeterChannel::init()
@@ -183,9 +225,15 @@ namespace lsp
             if (sColor.is(prop))
                 query_draw();
             if (sValueColor.is(prop))
+            {
+                bStrips     = false;
                 query_draw();
+            }
             if (sValueRanges.is(prop))
+            {
+                bStrips     = false;
                 query_draw();
+            }
             if (sPeakColor.is(prop) && (sPeakVisible.get()))
                 query_draw();
             if (sPeakRanges.is(prop) && (sPeakVisible.get()))
@@ -415,25 +463,106 @@ namespace lsp
             }
         }
 
+        void LedMeterChannel::draw_segment(ws::ISurface *s, const lsp::Color *c, bool lit, float bright,
+            float x, float y, float w, float h, float scaling)
+        {
+            lsp::Color fc(*c), bc(*c);
+            fc.scale_lightness(bright);
+            bc.scale_lightness(bright);
+
+            if (lit)
+                bc.alpha(0.5f);
+            else
+            {
+                bc.alpha(0.95f);
+                fc.alpha(0.9f);
+            }
+
+            s->fill_rect(bc, x, y, w, h);
+            s->fill_rect(fc, x + scaling, y + scaling,
+                lsp_max(0.0f, w - scaling * 2.0f), lsp_max(0.0f, h - scaling * 2.0f));
+        }
+
+        void LedMeterChannel::draw_strip(ws::ISurface *s, bool lit, ssize_t segments, ssize_t angle, float scaling, float bright)
+        {
+            float seg_size      = 4.0f * scaling;
+            float step          = sValue.range() / segments;
+            float first         = sValue.min();
+
+            float bx            = ((angle & 3) == 2) ? sAMeter.nWidth  - seg_size : 0.0f;
+            float by            = ((angle & 3) == 1) ? sAMeter.nHeight - seg_size : 0.0f;
+            float bw            = (angle & 1) ? sAMeter.nWidth : seg_size;
+            float bh            = (angle & 1) ? seg_size : sAMeter.nHeight;
+            float dx            = ((angle & 1)) ? 0.0f : ((angle & 2) ? -seg_size : seg_size);
+            float dy            = ((angle & 1)) ? ((angle & 2) ? seg_size : -seg_size) : 0.0f;
+
+            bool aa             = s->set_antialiasing(true);
+            for (ssize_t i=0; i<segments; ++i)
+            {
+                const lsp::Color *lc    = get_color(first + step * i, &sValueRanges, &sValueColor);
+                draw_segment(s, lc, lit, bright, bx, by, bw, bh, scaling);
+                bx                 += dx;
+                by                 += dy;
+            }
+            s->set_antialiasing(aa);
+        }
+
+        bool LedMeterChannel::sync_strips(ws::ISurface *s, ssize_t segments, ssize_t angle, float scaling, float bright)
+        {
+            // Check that strips are up to date
+            if ((bStrips) &&
+                (nStripWidth == sAMeter.nWidth) &&
+                (nStripHeight == sAMeter.nHeight) &&
+                (nStripAngle == angle) &&
+                (fStripScaling == scaling) &&
+                (fStripBright == bright) &&
+                (fStripMin == sValue.min()) &&
+                (fStripMax == sValue.max()))
+                return true;
+
+            // Re-create surfaces, they are always created transparent
+            drop_strips();
+            if ((sAMeter.nWidth <= 0) || (sAMeter.nHeight <= 0))
+                return false;
+
+            pLit                = s->create(sAMeter.nWidth, sAMeter.nHeight);
+            pUnlit              = s->create(sAMeter.nWidth, sAMeter.nHeight);
+            if ((pLit == NULL) || (pUnlit == NULL))
+            {
+                drop_strips();
+                return false;
+            }
+
+            // Render all segments into the strips
+            draw_strip(pLit, true, segments, angle, scaling, bright);
+            draw_strip(pUnlit, false, segments, angle, scaling, bright);
+
+            nStripWidth         = sAMeter.nWidth;
+            nStripHeight        = sAMeter.nHeight;
+            nStripAngle         = angle;
+            fStripScaling       = scaling;
+            fStripBright        = bright;
+            fStripMin           = sValue.min();
+            fStripMax           = sValue.max();
+            bStrips             = true;
+
+            return true;
+        }
+
         void LedMeterChannel::draw_meter(ws::ISurface *s, ssize_t angle, float scaling, float bright)
         {
             float seg_size      = 4.0f * scaling;
             float range         = sValue.range();
             ssize_t segments    = (angle & 1) ? (sAMeter.nHeight / seg_size) : (sAMeter.nWidth / seg_size);
+            if (segments <= 0)
+                return;
             float step          = range / segments;
-            lsp::Color fc, bc;
-            const lsp::Color *lc;
 
             float bx            = ((angle & 3) == 2) ? sAMeter.nLeft + sAMeter.nWidth  - seg_size : sAMeter.nLeft;
             float by            = ((angle & 3) == 1) ? sAMeter.nTop  + sAMeter.nHeight - seg_size : sAMeter.nTop;
             float bw            = (angle & 1) ? sAMeter.nWidth : seg_size;
             float bh            = (angle & 1) ? seg_size : sAMeter.nHeight;
 
-            float fx            = bx + scaling;
-            float fy            = by + scaling;
-            float fw            = lsp_max(0.0f, bw - scaling * 2.0f);
-            float fh            = lsp_max(0.0f, bh - scaling * 2.0f);
-
             float dx            = ((angle & 1)) ? 0.0f : ((angle & 2) ? -seg_size : seg_size);
             float dy            = ((angle & 1)) ? ((angle & 2) ? seg_size : -seg_size) : 0.0f;
 
@@ -448,19 +577,29 @@ namespace lsp
             float first         = sValue.min();
             float vmin          = sValue.min();
 
-            float aa            = s->set_antialiasing(true);
+            // Prepare strips of pre-rendered segments
+            bool strips         = sync_strips(s, segments, angle, scaling, bright);
+
+            // Segments are drawn as runs of lit and unlit segments taken from strips,
+            // the segments of peak and balance are drawn separately
+            ssize_t run_first   = 0;
+            ssize_t run_state   = -1;
+
+            for (ssize_t i=1; i<=segments + 1; ++i)
+            {
+                const lsp::Color *lc    = NULL;
+                ssize_t state           = -1;
 
-            s->clip_begin(&sAMeter);
-                for (ssize_t i=1; i<=segments; ++i)
+                if (i <= segments)
                 {
                     float vmax          = (i < segments) ? first + step * i : sValue.max();
 
-                    // Estimate the segment color (special values for peak and balance
+                    // Estimate the special segment color for peak and balance
                     if ((has_balance) && (vmin <= balance) && (balance < vmax))
                         lc                  = sBalanceColor.color();
                     else if ((has_peak) && (vmin <= peak) && (peak < vmax))
                         lc                  = get_color(peak,  &sPeakRanges, &sPeakColor);
-                    else
+                    else if (!strips)
                         lc                  = get_color(vmin, &sValueRanges, &sValueColor);
 
                     // Now determine if we need to darken the color
@@ -489,34 +628,46 @@ namespace lsp
                         matched    ^= reversive;
                     }
 
-                    // Compute color of the segment
-                    fc.copy(lc);
-                    bc.copy(lc);
-                    fc.scale_lightness(bright);
-                    bc.scale_lightness(bright);
-
-                    if (matched)
-                        bc.alpha(0.5f);
-                    else
+                    // Draw the segment that can not be taken from strips
+                    if (lc != NULL)
                     {
-                        bc.alpha(0.95f);
-                        fc.alpha(0.9f);
+                        s->clip_begin(&sAMeter);
+                            bool aa             = s->set_antialiasing(true);
+                            draw_segment(s, lc, matched, bright,
+                                bx + dx * (i - 1), by + dy * (i - 1), bw, bh, scaling);
+                            s->set_antialiasing(aa);
+                        s->clip_end();
                     }
+                    else
+                        state               = (matched) ? 1 : 0;
 
-                    // Draw the bar
-                    s->fill_rect(bc, bx, by, bw, bh);
-                    s->fill_rect(fc, fx, fy, fw, fh);
-
-                    // Update coordinates and value
                     vmin                = vmax;
-                    bx                 += dx;
-                    by                 += dy;
-                    fx                 += dx;
-                    fy                 += dy;
                 }
-            s->clip_end();
 
-            s->set_antialiasing(aa);
+                // Flush the run of segments
+                if (state == run_state)
+                    continue;
+
+                if (run_state >= 0)
+                {
+                    ssize_t last        = i - 2;
+                    float x1            = bx + dx * run_first;
+                    float y1            = by + dy * run_first;
+                    float x2            = bx + dx * last;
+                    float y2            = by + dy * last;
+                    float cx            = lsp_min(x1, x2);
+                    float cy            = lsp_min(y1, y2);
+                    float cw            = lsp_max(x1, x2) + bw - cx;
+                    float ch            = lsp_max(y1, y2) + bh - cy;
+
+                    s->clip_begin(cx, cy, cw, ch);
+                        s->draw((run_state > 0) ? pLit : pUnlit, sAMeter.nLeft, sAMeter.nTop);
+                    s->clip_end();
+                }
+
+                run_first           = i - 1;
+                run_state           = state;
+            }
         }
 
         const lsp::Color *LedMeterChannel::get_color(float value, const ColorRanges *ranges, const Color *dfl)
@@ -30,6 +30,23 @@ MTEST_BEGIN("tk.widgets.compound", listbox)
         char           *label;
     } handler_t;
 
+    class VirtualModel: public tk::IListBoxModel
+    {
+        public:
+            virtual size_t size()
+            {
+                return 100000;
+            }
+
+            virtual status_t format(LSPString *dst, size_t index)
+            {
+                return (dst->fmt_ascii("%s %d", (index % 6 == 0) ? "Virtual row with long text" : "Virtual row", int(index)))
+                    ? STATUS_OK : STATUS_NO_MEM;
+            }
+    };
+
+    VirtualModel sModel;
+
     static status_t slot_close(tk::Widget *sender, void *ptr, void *data)
     {
         sender->display()->quit_main();
@@ -96,6 +113,10 @@ MTEST_BEGIN("tk.widgets.compound", listbox)
                     if (lb != NULL)
                         lb->multi_select()->toggle();
                     break;
+                case 'l':
+                    if (lb != NULL)
+                        lb->set_model((lb->model() != NULL) ? NULL : &_this->sModel);
+                    break;
                 default:
                     break;
             }
@@ -92,6 +92,18 @@ MTEST_BEGIN("tk.widgets.containers", scrollarea)
                     if (sa != NULL)
                         sa->vscroll_mode()->set_always();
                     break;
+
+                // Scroll by a step larger than the viewport
+                case 'h':
+                    if (sa != NULL)
+                        sa->hscroll()->set((sa->hscroll()->get() > sa->hscroll()->min()) ?
+                            sa->hscroll()->min() : sa->hscroll()->max());
+                    break;
+                case 'j':
+                    if (sa != NULL)
+                        sa->vscroll()->set((sa->vscroll()->get() > sa->vscroll()->min()) ?
+                            sa->vscroll()->min() : sa->vscroll()->max());
+                    break;
                 default:
                     break;
             }
@@ -602,6 +602,36 @@ MTEST_BEGIN("tk.widgets.graph", graph)
             gms->data()->set_y(graph_y, sizeof(graph_y)/sizeof(float));
             gms->smooth()->set(true);
 
+            // Add mesh set
+            tk::GraphMeshSet *gmset;
+            static const uint32_t series_colors[] = { 0xff0000, 0xffff00, 0x00ff00, 0xff00ff };
+            float set_x[256], set_y[256];
+
+            MTEST_ASSERT(gmset = new tk::GraphMeshSet(dpy));
+            MTEST_ASSERT(id.fmt_ascii("meshset_%d", wid++));
+            MTEST_ASSERT(init_widget(gmset, vh, id.get_ascii()) == STATUS_OK);
+            MTEST_ASSERT(widgets.push(gmset));
+            MTEST_ASSERT(gr->add(gmset) == STATUS_OK);
+
+            gmset->width()->set(1);
+            gmset->origin()->set(0);
+            gmset->haxis()->set(0);
+            gmset->vaxis()->set(1);
+
+            for (size_t i=0; i<sizeof(series_colors)/sizeof(uint32_t); ++i)
+            {
+                tk::GraphMeshSeries *gs = gmset->add_series();
+                MTEST_ASSERT(gs != NULL);
+
+                for (size_t j=0; j<256; ++j)
+                {
+                    set_x[j]    = 10.0f * expf(j * logf(2400.0f) / 255.0f);
+                    set_y[j]    = 60.0f + (i + 1) * 10.0f * sinf(j * (i + 1) * 0.05f);
+                }
+
+                gs->color()->set_rgb24(series_colors[i]);
+                MTEST_ASSERT(gs->data()->set(set_x, set_y, 256));
+            }
 
             // Create axes
             tk::GraphAxis *ga;
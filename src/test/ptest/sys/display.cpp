@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/tk/tk.h>
+
+#define WIDGETS_COUNT       10000
+
+PTEST_BEGIN("tk.sys", display, 5, 100)
+
+    PTEST_MAIN
+    {
+        tk::Display dpy;
+        char name[64];
+
+        // The widget pointers are only used as keys and are never dereferenced
+        uint8_t *buf = static_cast<uint8_t *>(malloc(WIDGETS_COUNT * 16));
+        if (buf == NULL)
+            return;
+
+        // Register widgets
+        printf("Registering %d widgets...\n", int(WIDGETS_COUNT));
+        for (size_t i=0; i<WIDGETS_COUNT; ++i)
+        {
+            snprintf(name, sizeof(name), "widget.%d", int(i));
+            dpy.add(reinterpret_cast<tk::Widget *>(&buf[i * 16]), name);
+        }
+
+        PTEST_LOOP("get(id)",
+            for (size_t i=0; i<WIDGETS_COUNT; i += 7)
+            {
+                snprintf(name, sizeof(name), "widget.%d", int(i));
+                dpy.get(name);
+            }
+        );
+
+        PTEST_LOOP("exists(widget)",
+            for (size_t i=0; i<WIDGETS_COUNT; i += 7)
+                dpy.exists(reinterpret_cast<tk::Widget *>(&buf[i * 16]));
+        );
+
+        PTEST_LOOP("remove(id) + add(widget, id)",
+            for (size_t i=0; i<WIDGETS_COUNT; i += 7)
+            {
+                snprintf(name, sizeof(name), "widget.%d", int(i));
+                tk::Widget *x = dpy.remove(name);
+                dpy.add(x, name);
+            }
+        );
+
+        // Deregister widgets to prevent them from being destroyed by the display
+        for (size_t i=0; i<WIDGETS_COUNT; ++i)
+        {
+            snprintf(name, sizeof(name), "widget.%d", int(i));
+            dpy.remove(name);
+        }
+
+        free(buf);
+    }
+
+PTEST_END
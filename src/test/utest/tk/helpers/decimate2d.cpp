@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/tk/helpers/graphics.h>
+#include <lsp-plug.in/common/alloc.h>
+
+#include <math.h>
+#include <stdlib.h>
+
+#define POINTS          8192
+#define COLUMNS         600
+
+UTEST_BEGIN("tk.helpers", decimate2d)
+
+    void check_column_peaks(const float *sx, const float *sy, size_t sn, const float *dx, const float *dy, size_t dn)
+    {
+        for (size_t col=0; col<COLUMNS; ++col)
+        {
+            float smin = INFINITY, smax = -INFINITY;
+            float dmin = INFINITY, dmax = -INFINITY;
+
+            for (size_t i=0; i<sn; ++i)
+            {
+                if (size_t(sx[i]) != col)
+                    continue;
+                smin    = lsp_min(smin, sy[i]);
+                smax    = lsp_max(smax, sy[i]);
+            }
+            for (size_t i=0; i<dn; ++i)
+            {
+                if (size_t(dx[i]) != col)
+                    continue;
+                dmin    = lsp_min(dmin, dy[i]);
+                dmax    = lsp_max(dmax, dy[i]);
+            }
+
+            UTEST_ASSERT_MSG((smin == dmin) && (smax == dmax),
+                "Peaks mismatch at column %d: got [%f, %f], expected [%f, %f]",
+                int(col), dmin, dmax, smin, smax);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *sx       = lsp::alloc_aligned<float>(data, POINTS * 4);
+        UTEST_ASSERT(sx != NULL);
+        float *sy       = &sx[POINTS];
+        float *dx       = &sy[POINTS];
+        float *dy       = &dx[POINTS];
+
+        // Spectrum-like curve with random peaks
+        for (size_t i=0; i<POINTS; ++i)
+        {
+            sx[i]           = (float(i) * COLUMNS) / POINTS;
+            sy[i]           = sinf(i * 0.01f) * 100.0f + (rand() % 1000) * 0.01f;
+        }
+        for (size_t i=0; i<POINTS; ++i)
+        {
+            dx[i]           = sx[i];
+            dy[i]           = sy[i];
+        }
+
+        size_t n        = tk::decimate2d(dx, dy, POINTS);
+        printf("Decimated %d points to %d points\n", int(POINTS), int(n));
+
+        UTEST_ASSERT(n <= COLUMNS * 4);
+        UTEST_ASSERT((dx[0] == sx[0]) && (dy[0] == sy[0]));
+        UTEST_ASSERT((dx[n-1] == sx[POINTS-1]) && (dy[n-1] == sy[POINTS-1]));
+        for (size_t i=1; i<n; ++i)
+            UTEST_ASSERT(dx[i-1] <= dx[i]);
+        check_column_peaks(sx, sy, POINTS, dx, dy, n);
+
+        // Sparse polyline should remain untouched
+        for (size_t i=0; i<16; ++i)
+        {
+            dx[i]           = i * 10.0f;
+            dy[i]           = sy[i];
+        }
+        UTEST_ASSERT(tk::decimate2d(dx, dy, 16) == 16);
+        for (size_t i=0; i<16; ++i)
+            UTEST_ASSERT((dx[i] == i * 10.0f) && (dy[i] == sy[i]));
+
+        // Non-monotonic polyline should remain untouched
+        for (size_t i=0; i<POINTS; ++i)
+        {
+            dx[i]           = sinf(i * 0.01f) * COLUMNS * 0.5f;
+            dy[i]           = sy[i];
+        }
+        UTEST_ASSERT(tk::decimate2d(dx, dy, POINTS) == POINTS);
+        for (size_t i=0; i<POINTS; ++i)
+            UTEST_ASSERT(dy[i] == sy[i]);
+
+        lsp::free_aligned(data);
+    }
+
+UTEST_END
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+
+#include <stdlib.h>
+
+UTEST_BEGIN("tk.prop.collection", floatarray)
+
+    void check_peaks(tk::prop::FloatArray *a, size_t first, size_t count)
+    {
+        float min, max;
+        UTEST_ASSERT(a->peaks(&min, &max, first, count));
+
+        const float *v  = a->values();
+        size_t last     = lsp_min(first + count, a->size());
+        float xmin      = v[first], xmax = v[first];
+        for (size_t i=first+1; i<last; ++i)
+        {
+            xmin            = lsp_min(xmin, v[i]);
+            xmax            = lsp_max(xmax, v[i]);
+        }
+
+        UTEST_ASSERT_MSG((min == xmin) && (max == xmax),
+            "Peaks mismatch for range [%d, %d): got [%f, %f], expected [%f, %f]",
+            int(first), int(last), min, max, xmin, xmax);
+    }
+
+    void check_random_ranges(tk::prop::FloatArray *a, size_t iterations)
+    {
+        size_t n = a->size();
+        for (size_t i=0; i<iterations; ++i)
+        {
+            size_t first    = rand() % n;
+            size_t count    = 1 + rand() % (n - first);
+            check_peaks(a, first, count);
+        }
+        check_peaks(a, 0, n);
+    }
+
+    void fill_random(float *v, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+            v[i]    = (float(rand()) / RAND_MAX) * 2.0f - 1.0f;
+    }
+
+    UTEST_MAIN
+    {
+        tk::prop::FloatArray a;
+        float buf[0x1000];
+        float min, max;
+
+        srand(0);
+
+        // Empty array has no peaks
+        UTEST_ASSERT(!a.peaks(&min, &max, 0, 1));
+
+        // Build the pyramid
+        fill_random(buf, 0x1000);
+        for (size_t i=0; i<0x10; ++i)
+            UTEST_ASSERT(a.append(buf, 0x1000) == STATUS_OK);
+        printf("Checking initial state...\n");
+        check_random_ranges(&a, 1000);
+
+        // Modify single elements
+        printf("Checking modification of elements...\n");
+        UTEST_ASSERT(a.set(12345, 10.0f) == STATUS_OK);
+        UTEST_ASSERT(a.set(54321, -10.0f) == STATUS_OK);
+        check_random_ranges(&a, 1000);
+        UTEST_ASSERT(a.peaks(&min, &max, 0, a.size()));
+        UTEST_ASSERT((min == -10.0f) && (max == 10.0f));
+
+        // Remove the extremums
+        printf("Checking removal of elements...\n");
+        UTEST_ASSERT(a.remove(54321) == STATUS_OK);
+        UTEST_ASSERT(a.remove(12345) == STATUS_OK);
+        check_random_ranges(&a, 1000);
+
+        // Insert and append data
+        printf("Checking insertion of elements...\n");
+        fill_random(buf, 0x1000);
+        UTEST_ASSERT(a.insert(777, buf, 333) == STATUS_OK);
+        UTEST_ASSERT(a.append(&buf[333], 17) == STATUS_OK);
+        UTEST_ASSERT(a.prepend(&buf[1000], 5) == STATUS_OK);
+        check_random_ranges(&a, 1000);
+
+        // Shrink the array
+        printf("Checking shrinking of the array...\n");
+        UTEST_ASSERT(a.resize(1000) == STATUS_OK);
+        check_random_ranges(&a, 1000);
+        UTEST_ASSERT(a.resize(17) == STATUS_OK);
+        check_random_ranges(&a, 100);
+        UTEST_ASSERT(a.resize(1) == STATUS_OK);
+        check_peaks(&a, 0, 1);
+
+        // Grow the array again
+        printf("Checking growth of the array...\n");
+        UTEST_ASSERT(a.resize(5000) == STATUS_OK);
+        check_random_ranges(&a, 1000);
+    }
+
+UTEST_END
@@ -97,6 +97,11 @@ UTEST_BEGIN("tk.style", nesting)
             Style               sStyle;
             const char         *pParent;
             test_type_t        *pTest;
+            size_t              nChanges;
+            size_t              nInt;
+            size_t              nFloat;
+            size_t              nColor;
+            size_t              nScaling;
 
             prop::Integer       sInt;
             prop::Float         sFloat;
@@ -115,6 +120,11 @@ UTEST_BEGIN("tk.style", nesting)
                 pSchema     = schema;
                 pParent     = style;
                 pTest       = test;
+                nChanges    = 0;
+                nInt        = 0;
+                nFloat      = 0;
+                nColor      = 0;
+                nScaling    = 0;
             }
 
             virtual ~StyleClient()
@@ -142,14 +152,42 @@ UTEST_BEGIN("tk.style", nesting)
 
             virtual void property_changed(Property *prop)
             {
+                ++nChanges;
                 if (sInt.is(prop))
+                {
+                    ++nInt;
                     pTest->printf("  %s.int -> %d\n", pParent, int(sInt.get()));
+                }
                 if (sFloat.is(prop))
+                {
+                    ++nFloat;
                     pTest->printf("  %s.float -> %f\n", pParent, sFloat.get());
+                }
                 if (sColor.is(prop))
+                {
+                    ++nColor;
                     pTest->printf("  %s.color -> 0x%x\n", pParent, int(sColor.rgba32()));
+                }
                 if (sScaling.is(prop))
+                {
+                    ++nScaling;
                     pTest->printf("  %s.scaling -> %f\n", pParent, sScaling.get());
+                }
+            }
+
+            inline size_t changes() const           { return nChanges;  }
+            inline size_t int_changes() const       { return nInt;      }
+            inline size_t float_changes() const     { return nFloat;    }
+            inline size_t color_changes() const     { return nColor;    }
+            inline size_t scaling_changes() const   { return nScaling;  }
+
+            inline void reset_changes()
+            {
+                nChanges    = 0;
+                nInt        = 0;
+                nFloat      = 0;
+                nColor      = 0;
+                nScaling    = 0;
             }
 
         public:
@@ -225,6 +263,60 @@ UTEST_BEGIN("tk.style", nesting)
         UTEST_ASSERT(rgba32_cmp(c3.color()->rgb24(), 0x5a5a5a));
         printf("c3.scaling = %f\n", c3.scaling()->get());
         UTEST_ASSERT(float_equals_adaptive(c3.scaling()->get(), 1.5f));
+
+        // Apply the updated style sheet to the schema with bound clients:
+        //   - root.size.scaling changes for all clients
+        //   - TestBase.int changes only for TestChild2, TestChild3 overrides it
+        //   - TestChild3.color changes only for TestChild3
+        StyleSheet sUpdate;
+        UTEST_ASSERT(sUpdate.parse_data(
+            "<schema>"
+                "<root>"
+                    "<size.scaling value=\"2.0\" />"
+                "</root>"
+                "<style class=\"TestBase\" parents=\"root\">"
+                    "<int value=\"96000\" />"
+                    "<float value=\"1.41\" />"
+                    "<color value=\"#ccddee\" />"
+                "</style>"
+                "<style class=\"TestChild1\" parents=\"root\">"
+                "</style>"
+                "<style class=\"TestChild2\" parents=\"TestBase\">"
+                "</style>"
+                "<style class=\"TestChild3\" parents=\"TestBase\">"
+                    "<int value=\"44100\" />"
+                    "<float value=\"10.0\" />"
+                    "<color value=\"#123456\" />"
+                "</style>"
+            "</schema>"
+        ) == STATUS_OK);
+
+        c1.reset_changes();
+        c2.reset_changes();
+        c3.reset_changes();
+        UTEST_ASSERT(sSchema.apply(&sUpdate) == STATUS_OK);
+        printf("changes: c1=%d, c2=%d, c3=%d\n", int(c1.changes()), int(c2.changes()), int(c3.changes()));
+
+        // Each changed property should be notified exactly once per client
+        UTEST_ASSERT(c1.scaling_changes() == 1);
+        UTEST_ASSERT(c2.scaling_changes() == 1);
+        UTEST_ASSERT(c2.int_changes() == 1);
+        UTEST_ASSERT(c3.scaling_changes() == 1);
+        UTEST_ASSERT(c3.color_changes() == 1);
+
+        // Check the new state of clients
+        UTEST_ASSERT(c1.ivalue()->get() == 440);
+        UTEST_ASSERT(float_equals_adaptive(c1.fvalue()->get(), 3.14f));
+        UTEST_ASSERT(rgba32_cmp(c1.color()->rgb24(), 0x112233));
+        UTEST_ASSERT(float_equals_adaptive(c1.scaling()->get(), 2.0f));
+        UTEST_ASSERT(c2.ivalue()->get() == 96000);
+        UTEST_ASSERT(float_equals_adaptive(c2.fvalue()->get(), 1.41f));
+        UTEST_ASSERT(rgba32_cmp(c2.color()->rgb24(), 0xccddee));
+        UTEST_ASSERT(float_equals_adaptive(c2.scaling()->get(), 2.0f));
+        UTEST_ASSERT(c3.ivalue()->get() == 44100);
+        UTEST_ASSERT(float_equals_adaptive(c3.fvalue()->get(), 10.0f));
+        UTEST_ASSERT(rgba32_cmp(c3.color()->rgb24(), 0x123456));
+        UTEST_ASSERT(float_equals_adaptive(c3.scaling()->get(), 2.0f));
     }
 
 UTEST_END
@@ -646,6 +646,61 @@ UTEST_BEGIN("tk.style", style)
         UTEST_ASSERT(v == 20);
     }
 
+    void test_parent_cache(tk::Schema *schema)
+    {
+        tk::Style g1(schema);
+        tk::Style g2(schema);
+        tk::Style p(schema);
+        tk::Style c(schema);
+
+        tk::atom_t v1 = atom("cached1");
+        tk::atom_t v2 = atom("cached2");
+        ssize_t v;
+
+        printf("Testing parent property resolution cache...\n");
+        UTEST_ASSERT(g1.init() == STATUS_OK);
+        UTEST_ASSERT(g2.init() == STATUS_OK);
+        UTEST_ASSERT(p.init() == STATUS_OK);
+        UTEST_ASSERT(c.init() == STATUS_OK);
+
+        UTEST_ASSERT(p.add_parent(&g1) == STATUS_OK);
+        UTEST_ASSERT(c.add_parent(&p) == STATUS_OK);
+
+        // Resolve values through the whole chain
+        UTEST_ASSERT(g1.set_int(v1, 1) == STATUS_OK);
+        UTEST_ASSERT(g2.set_int(v1, 2) == STATUS_OK);
+        UTEST_ASSERT(c.get_int(v1, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 1);
+        UTEST_ASSERT(c.get_int(v2, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 0);
+
+        // Property created in the middle of the chain should override the cached one
+        UTEST_ASSERT(g1.set_int(v2, 10) == STATUS_OK);
+        UTEST_ASSERT(c.get_int(v2, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 10);
+        UTEST_ASSERT(p.set_int(v2, 20) == STATUS_OK);
+        UTEST_ASSERT(c.get_int(v2, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 20);
+
+        // Changing parents of the intermediate style should invalidate the cache
+        UTEST_ASSERT(p.remove_parent(&g1) == STATUS_OK);
+        UTEST_ASSERT(c.get_int(v1, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 0);
+        UTEST_ASSERT(p.add_parent(&g2) == STATUS_OK);
+        UTEST_ASSERT(c.get_int(v1, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 2);
+        UTEST_ASSERT(p.add_parent(&g1) == STATUS_OK);
+        UTEST_ASSERT(c.get_int(v1, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 1);
+
+        // Destroying the parent should invalidate the cache
+        g1.destroy();
+        UTEST_ASSERT(c.get_int(v1, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 2);
+        UTEST_ASSERT(c.get_int(v2, &v) == STATUS_OK);
+        UTEST_ASSERT(v == 20);
+    }
+
     void test_notifications()
     {
         tk::Schema schema(&atoms);
@@ -788,6 +843,7 @@ UTEST_BEGIN("tk.style", style)
         test_binding(root);
         test_function(root);
         test_multiple_parents(&schema);
+        test_parent_cache(&schema);
 
         test_notifications();
     }
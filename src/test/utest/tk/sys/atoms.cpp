@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/tk/tk.h>
+
+#define ATOMS_COUNT     10000
+
+UTEST_BEGIN("tk.sys", atoms)
+
+    UTEST_MAIN
+    {
+        tk::Atoms atoms;
+        char name[64];
+
+        // Built-in atoms should be already registered
+        size_t builtin = atoms.size();
+        UTEST_ASSERT(builtin > 0);
+        UTEST_ASSERT(atoms.find_atom("bg.color") >= 0);
+        UTEST_ASSERT(atoms.find_atom("font.size") >= 0);
+        UTEST_ASSERT(atoms.find_atom("allocation.hexpand") >= 0);
+        UTEST_ASSERT(atoms.find_atom("padding.css") >= 0);
+        UTEST_ASSERT(atoms.find_atom("unknown.atom.name") < 0);
+        UTEST_ASSERT(atoms.atom_id((const char *)NULL) < 0);
+
+        // Register atoms
+        printf("Registering %d atoms...\n", int(ATOMS_COUNT));
+        for (size_t i=0; i<ATOMS_COUNT; ++i)
+        {
+            snprintf(name, sizeof(name), "test.atom.%d", int(i));
+            UTEST_ASSERT(atoms.atom_id(name) == tk::atom_t(builtin + i));
+        }
+        UTEST_ASSERT(atoms.size() == builtin + ATOMS_COUNT);
+
+        // Lookup atoms
+        printf("Looking up %d atoms...\n", int(ATOMS_COUNT));
+        for (size_t i=0; i<ATOMS_COUNT; ++i)
+        {
+            tk::atom_t id = builtin + i;
+            snprintf(name, sizeof(name), "test.atom.%d", int(i));
+            UTEST_ASSERT(atoms.find_atom(name) == id);
+            UTEST_ASSERT(atoms.atom_id(name) == id);
+            UTEST_ASSERT(strcmp(atoms.atom_name(id), name) == 0);
+        }
+        UTEST_ASSERT(atoms.size() == builtin + ATOMS_COUNT);
+    }
+
+UTEST_END
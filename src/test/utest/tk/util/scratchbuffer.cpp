@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+
+UTEST_BEGIN("tk.util", scratchbuffer)
+
+    UTEST_MAIN
+    {
+        tk::ScratchBuffer buf;
+        UTEST_ASSERT(buf.capacity() == 0);
+        UTEST_ASSERT(buf.allocations() == 0);
+
+        // First request allocates memory
+        float *p = buf.get(100);
+        UTEST_ASSERT(p != NULL);
+        UTEST_ASSERT(buf.capacity() >= 100);
+        UTEST_ASSERT(buf.allocations() == 1);
+        for (size_t i=0; i<100; ++i)
+            p[i]    = i;
+
+        // Repeated and smaller requests should not allocate
+        for (size_t i=0; i<1000; ++i)
+        {
+            UTEST_ASSERT(buf.get(100 - (i % 100)) == p);
+        }
+        UTEST_ASSERT(buf.allocations() == 1);
+
+        // Growth over the capacity performs exactly one allocation
+        size_t cap  = buf.capacity();
+        p           = buf.get(cap + 1);
+        UTEST_ASSERT(p != NULL);
+        UTEST_ASSERT(buf.capacity() > cap);
+        UTEST_ASSERT(buf.allocations() == 2);
+        UTEST_ASSERT(buf.get(cap) == p);
+        UTEST_ASSERT(buf.allocations() == 2);
+
+        // Flush releases the memory
+        buf.flush();
+        UTEST_ASSERT(buf.capacity() == 0);
+        UTEST_ASSERT(buf.allocations() == 2);
+    }
+
+UTEST_END
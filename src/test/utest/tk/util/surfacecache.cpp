@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+
+UTEST_BEGIN("tk.util", surfacecache)
+
+    UTEST_MAIN
+    {
+        tk::SurfaceCache cache;
+        ws::ISurface *s[4];
+        uint32_t key;
+
+        cache.set_limit(3);
+        UTEST_ASSERT(cache.limit() == 3);
+        UTEST_ASSERT(cache.size() == 0);
+
+        // Fill the cache
+        for (size_t i=0; i<3; ++i)
+        {
+            key     = i;
+            s[i]    = new ws::ISurface();
+            UTEST_ASSERT(s[i] != NULL);
+            UTEST_ASSERT(cache.put(&key, sizeof(key), s[i]) == STATUS_OK);
+        }
+        UTEST_ASSERT(cache.size() == 3);
+
+        // Lookup by key, keys of different size do not match
+        for (size_t i=0; i<3; ++i)
+        {
+            key     = i;
+            UTEST_ASSERT(cache.get(&key, sizeof(key)) == s[i]);
+        }
+        key     = 0;
+        UTEST_ASSERT(cache.get(&key, sizeof(uint16_t)) == NULL);
+        key     = 3;
+        UTEST_ASSERT(cache.get(&key, sizeof(key)) == NULL);
+
+        // Touch the first item, the second one becomes the least recently used and is evicted
+        key     = 0;
+        UTEST_ASSERT(cache.get(&key, sizeof(key)) == s[0]);
+        key     = 3;
+        s[3]    = new ws::ISurface();
+        UTEST_ASSERT(cache.put(&key, sizeof(key), s[3]) == STATUS_OK);
+        UTEST_ASSERT(cache.size() == 3);
+
+        key     = 1;
+        UTEST_ASSERT(cache.get(&key, sizeof(key)) == NULL);
+        key     = 0;
+        UTEST_ASSERT(cache.get(&key, sizeof(key)) == s[0]);
+        key     = 2;
+        UTEST_ASSERT(cache.get(&key, sizeof(key)) == s[2]);
+        key     = 3;
+        UTEST_ASSERT(cache.get(&key, sizeof(key)) == s[3]);
+
+        // Replace the surface with the same key
+        key     = 2;
+        s[2]    = new ws::ISurface();
+        UTEST_ASSERT(cache.put(&key, sizeof(key), s[2]) == STATUS_OK);
+        UTEST_ASSERT(cache.size() == 3);
+        UTEST_ASSERT(cache.get(&key, sizeof(key)) == s[2]);
+
+        // Shrink the cache, only the most recently used item remains
+        cache.set_limit(1);
+        UTEST_ASSERT(cache.size() == 1);
+        UTEST_ASSERT(cache.get(&key, sizeof(key)) == s[2]);
+
+        // Flush the cache
+        cache.flush();
+        UTEST_ASSERT(cache.size() == 0);
+        UTEST_ASSERT(cache.get(&key, sizeof(key)) == NULL);
+    }
+
+UTEST_END
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2020 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2020 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+UTEST_BEGIN("tk.util", textcache)
+
+    void put(tk::TextCache *c, const ws::Font *f, const LSPString *s, float width)
+    {
+        ws::text_parameters_t tp;
+        ::memset(&tp, 0, sizeof(tp));
+        tp.Width    = width;
+        UTEST_ASSERT(c->put(f, &tp, s, 0, s->length()) == STATUS_OK);
+    }
+
+    bool get(tk::TextCache *c, const ws::Font *f, const LSPString *s, float *width)
+    {
+        ws::text_parameters_t tp;
+        if (!c->get(f, &tp, s, 0, s->length()))
+            return false;
+        *width      = tp.Width;
+        return true;
+    }
+
+    UTEST_MAIN
+    {
+        tk::TextCache c;
+        LSPString s1, s2, s3;
+        float w;
+
+        UTEST_ASSERT(s1.set_ascii("Hello"));
+        UTEST_ASSERT(s2.set_ascii("World"));
+        UTEST_ASSERT(s3.set_ascii("Hello World"));
+
+        ws::Font f1("Sans", 12.0f, 0);
+        ws::Font f2("Sans", 14.0f, 0);
+        ws::Font f3("Sans", 12.0f, ws::FF_BOLD);
+        ws::Font f4("Mono", 12.0f, 0);
+
+        // Empty cache
+        UTEST_ASSERT(!get(&c, &f1, &s1, &w));
+        UTEST_ASSERT(c.misses() == 1);
+        UTEST_ASSERT(c.hits() == 0);
+
+        // Records are distinguished by font name, size, flags and text
+        put(&c, &f1, &s1, 1.0f);
+        put(&c, &f2, &s1, 2.0f);
+        put(&c, &f3, &s1, 3.0f);
+        put(&c, &f4, &s1, 4.0f);
+        put(&c, &f1, &s2, 5.0f);
+        UTEST_ASSERT(c.size() == 5);
+
+        UTEST_ASSERT(get(&c, &f1, &s1, &w) && (w == 1.0f));
+        UTEST_ASSERT(get(&c, &f2, &s1, &w) && (w == 2.0f));
+        UTEST_ASSERT(get(&c, &f3, &s1, &w) && (w == 3.0f));
+        UTEST_ASSERT(get(&c, &f4, &s1, &w) && (w == 4.0f));
+        UTEST_ASSERT(get(&c, &f1, &s2, &w) && (w == 5.0f));
+        UTEST_ASSERT(!get(&c, &f2, &s2, &w));
+        UTEST_ASSERT(c.hits() == 5);
+        UTEST_ASSERT(c.misses() == 2);
+
+        // Sub-ranges of the string are matched by contents
+        ws::text_parameters_t tp;
+        UTEST_ASSERT(c.get(&f1, &tp, &s3, 0, 5) && (tp.Width == 1.0f));
+        UTEST_ASSERT(c.get(&f1, &tp, &s3, 6, 11) && (tp.Width == 5.0f));
+        UTEST_ASSERT(!c.get(&f1, &tp, &s3, 0, 11));
+
+        // The least recently used records are evicted
+        c.reset_stats();
+        c.set_limit(2);
+        UTEST_ASSERT(c.size() == 2);
+        UTEST_ASSERT(get(&c, &f1, &s1, &w) && (w == 1.0f));
+        UTEST_ASSERT(get(&c, &f1, &s2, &w) && (w == 5.0f));
+        UTEST_ASSERT(!get(&c, &f2, &s1, &w));
+
+        put(&c, &f2, &s1, 6.0f);
+        UTEST_ASSERT(c.size() == 2);
+        UTEST_ASSERT(!get(&c, &f1, &s1, &w));
+        UTEST_ASSERT(get(&c, &f1, &s2, &w) && (w == 5.0f));
+        UTEST_ASSERT(get(&c, &f2, &s1, &w) && (w == 6.0f));
+        UTEST_ASSERT(c.hits() == 4);
+        UTEST_ASSERT(c.misses() == 2);
+
+        // Flush drops all records
+        c.flush();
+        UTEST_ASSERT(c.size() == 0);
+        UTEST_ASSERT(!get(&c, &f1, &s2, &w));
+    }
+
+UTEST_END